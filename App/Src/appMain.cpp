@@ -259,6 +259,334 @@ void demoFilledCircles()
 	}
 }
 
+void demoFilledPolygons()
+{
+	for (uint8_t r = 0; r < 4; r++)
+	{
+		LCD_SetRotation(r);
+
+		LCD_Clear(LCD_COLOR_WHITE);
+
+		int16_t cx = LCD_GetWidth() / 2;
+		int16_t cy = LCD_GetHeight() / 4;
+
+		Point star[5] =
+		{
+		{ cx, (int16_t) (cy - 60) },
+		{ (int16_t) (cx + 35), (int16_t) (cy + 50) },
+		{ (int16_t) (cx - 57), (int16_t) (cy - 18) },
+		{ (int16_t) (cx + 57), (int16_t) (cy - 18) },
+		{ (int16_t) (cx - 35), (int16_t) (cy + 50) } };
+
+		LCD_SetTextColor(lcd_colors[r]);
+
+		LCD_FillPolygon(star, 5, EVENODD_RULE);
+
+		for (uint8_t i = 0; i < 5; i++)
+		{
+			star[i].Y += cy * 2;
+		}
+
+		LCD_FillPolygon(star, 5, NONZERO_RULE);
+
+		LCD_SetTextColor(LCD_COLOR_BLACK);
+
+		LCD_FillTriangle(cx - 20, cy * 2 - 10, cx + 20, cy * 2 - 10, cx, cy * 2 + 10);
+
+		HAL_Delay(1000);
+	}
+}
+
+void demoRoundShapes()
+{
+	for (uint8_t r = 0; r < 4; r++)
+	{
+		LCD_SetRotation(r);
+
+		LCD_Clear(LCD_COLOR_WHITE);
+
+		int16_t cx = LCD_GetWidth() / 2;
+		int16_t cy = LCD_GetHeight() / 2;
+
+		LCD_SetTextColor(lcd_colors[r]);
+		LCD_FillRoundRect(10, 10, LCD_GetWidth() - 20, 40, 12);
+
+		LCD_SetTextColor(LCD_COLOR_BLACK);
+		LCD_DrawRoundRect(10, 10, LCD_GetWidth() - 20, 40, 12);
+
+		/* Gauge */
+		LCD_SetTextColor(LCD_COLOR_LIGHTGRAY);
+		LCD_FillPie(cx, cy, 60, 135, 405);
+		LCD_SetTextColor(LCD_COLOR_RED);
+		LCD_FillPie(cx, cy, 60, 135, 135 + 90 * (r + 1) * 3 / 4);
+		LCD_SetTextColor(LCD_COLOR_WHITE);
+		LCD_FillCircle(cx, cy, 45);
+		LCD_SetTextColor(LCD_COLOR_BLACK);
+		LCD_DrawArc(cx, cy, 62, 135, 405);
+
+		/* Needle */
+		LCD_DrawThickLine(cx, cy, cx - 40, cy + 5, 5, ROUND_CAP);
+
+		LCD_DrawThickLine(10, LCD_GetHeight() - 30, LCD_GetWidth() - 10, LCD_GetHeight() - 50, 8, SQUARE_CAP);
+
+		HAL_Delay(1000);
+	}
+}
+
+void demoAALines()
+{
+	for (uint8_t r = 0; r < 4; r++)
+	{
+		LCD_SetRotation(r);
+
+		LCD_Clear(LCD_COLOR_BLACK);
+
+		LCD_SetBackColor(LCD_COLOR_BLACK);
+		LCD_SetTextColor(LCD_COLOR_WHITE);
+
+		LCD_SetAAMode(AA_BACKCOLOR_MODE);
+
+		int16_t cx = LCD_GetWidth() / 2;
+		int16_t cy = LCD_GetHeight() / 2;
+
+		for (int16_t x = 0; x < LCD_GetWidth(); x += 12)
+		{
+			LCD_DrawAALine(cx, cy, x, 0);
+			LCD_DrawAALine(cx, cy, LCD_GetWidth() - 1 - x, LCD_GetHeight() - 1);
+		}
+
+		LCD_SetTextColor(lcd_colors[r]);
+
+		LCD_SetAAMode(AA_READBACK_MODE);
+
+		for (uint16_t radius = 10; radius < cx; radius += 15)
+		{
+			LCD_DrawAACircle(cx, cy, radius);
+		}
+
+		HAL_Delay(1000);
+	}
+
+	LCD_SetAAMode(AA_BACKCOLOR_MODE);
+}
+
+/* Float based fill used by LCD_FillEllipse before the integer rewrite, kept for comparison */
+static void legacyFillEllipse(int Xpos, int Ypos, int XRadius, int YRadius)
+{
+	int x = 0, y = -YRadius, err = 2 - 2 * XRadius, e2;
+	float K = (float) YRadius / (float) XRadius;
+
+	do
+	{
+		LCD_DrawHLine((Xpos - (uint16_t) (x / K)), (Ypos + y), (2 * (uint16_t) (x / K) + 1));
+		LCD_DrawHLine((Xpos - (uint16_t) (x / K)), (Ypos - y), (2 * (uint16_t) (x / K) + 1));
+
+		e2 = err;
+		if (e2 <= x)
+		{
+			err += ++x * 2 + 1;
+			if (-y == x && e2 <= y) e2 = 0;
+		}
+		if (e2 > y) err += ++y * 2 + 1;
+	}
+	while (y <= 0);
+}
+
+void benchEllipses()
+{
+	LCD_SetRotation(0);
+
+	LCD_Clear(LCD_COLOR_WHITE);
+
+	uint16_t cx = LCD_GetWidth() / 2;
+	uint16_t cy = LCD_GetHeight() / 2;
+
+	LCD_SetTextColor(LCD_COLOR_RED);
+
+	uint32_t start = HAL_GetTick();
+
+	for (uint16_t i = 0; i < 10; i++)
+	{
+		for (uint16_t r = 5; r < cx; r += 5)
+		{
+			legacyFillEllipse(cx, cy, r, r / 2 + 1);
+		}
+	}
+
+	uint32_t legacy = HAL_GetTick() - start;
+
+	LCD_SetTextColor(LCD_COLOR_BLUE);
+
+	start = HAL_GetTick();
+
+	for (uint16_t i = 0; i < 10; i++)
+	{
+		for (uint16_t r = 5; r < cx; r += 5)
+		{
+			LCD_FillEllipse(cx, cy, r, r / 2 + 1);
+		}
+	}
+
+	printf("FillEllipse: float %lu ms, integer %lu ms\n", legacy, HAL_GetTick() - start);
+
+	HAL_Delay(1000);
+}
+
+void demoGradients()
+{
+	LCD_SetRotation(0);
+
+	uint16_t w = LCD_GetWidth();
+	uint16_t h = LCD_GetHeight();
+
+	uint32_t start = HAL_GetTick();
+
+	/* One FillRect per color step */
+	for (uint16_t y = 0; y < h; y++)
+	{
+		LCD_SetTextColor(((y * 32 / h) << 11) | (31 - y * 32 / h));
+		LCD_FillRect(0, y, w, 1);
+	}
+
+	uint32_t stepped = HAL_GetTick() - start;
+
+	start = HAL_GetTick();
+
+	LCD_FillGradient(0, 0, w, h, LCD_COLOR_BLUE, LCD_COLOR_RED, VERTICAL_GRADIENT);
+
+	uint32_t vertical = HAL_GetTick() - start;
+
+	start = HAL_GetTick();
+
+	LCD_FillGradient(0, 0, w, h, LCD_COLOR_BLUE, LCD_COLOR_RED, VERTICAL_GRADIENT | DITHER_GRADIENT);
+
+	printf("Gradient: FillRect %lu ms, streamed %lu ms, dithered %lu ms\n", stepped, vertical, HAL_GetTick() - start);
+
+	HAL_Delay(1000);
+
+	for (uint8_t r = 0; r < 4; r++)
+	{
+		LCD_SetRotation(r);
+
+		w = LCD_GetWidth();
+		h = LCD_GetHeight();
+
+		LCD_FillGradient(0, 0, w, h / 2, LCD_COLOR_BLACK, LCD_COLOR_WHITE, HORIZONTAL_GRADIENT);
+		LCD_FillGradient(0, h / 2, w, h - h / 2, LCD_COLOR_BLACK, LCD_COLOR_WHITE, HORIZONTAL_GRADIENT | DITHER_GRADIENT);
+
+		HAL_Delay(1000);
+	}
+}
+
+void benchBatchRects()
+{
+	LCD_SetRotation(0);
+
+	LCD_Clear(LCD_COLOR_WHITE);
+
+	/* Bar chart, every bar made of stacked 4 pixel high cells */
+	Rect cells[120];
+	uint16_t count = 0;
+
+	for (uint16_t bar = 0; bar < 20; bar++)
+	{
+		for (uint16_t cell = 0; cell < 6; cell++)
+		{
+			cells[count].X = 10 + bar * 11;
+			cells[count].Y = LCD_GetHeight() - 20 - (cell + 1) * 4 * (1 + bar % 7);
+			cells[count].Width = 10;
+			cells[count].Height = 4 * (1 + bar % 7);
+			count++;
+		}
+	}
+
+	LCD_SetTextColor(LCD_COLOR_BLUE);
+
+	uint32_t start = HAL_GetTick();
+
+	for (uint16_t i = 0; i < 10; i++)
+	{
+		for (uint16_t n = 0; n < count; n++)
+		{
+			LCD_FillRect(cells[n].X, cells[n].Y, cells[n].Width, cells[n].Height);
+		}
+	}
+
+	uint32_t single = HAL_GetTick() - start;
+
+	start = HAL_GetTick();
+
+	for (uint16_t i = 0; i < 10; i++)
+	{
+		LCD_FillRects(cells, count, LCD_COLOR_RED);
+	}
+
+	printf("FillRect x%u: single %lu ms, batch %lu ms\n", count, single, HAL_GetTick() - start);
+
+	HAL_Delay(1000);
+}
+
+static void drawPanel(int16_t x, int16_t y)
+{
+	LCD_FillGradient(x, y, 100, 60, LCD_COLOR_DARKBLUE, LCD_COLOR_LIGHTBLUE, VERTICAL_GRADIENT);
+	LCD_SetTextColor(LCD_COLOR_WHITE);
+	LCD_DrawRoundRect(x, y, 100, 60, 8);
+	LCD_FillCircle(x + 20, y + 30, 10);
+	LCD_DrawThickLine(x + 40, y + 20, x + 90, y + 20, 3, ROUND_CAP);
+	LCD_DrawThickLine(x + 40, y + 40, x + 75, y + 40, 3, ROUND_CAP);
+}
+
+void benchCopyRect()
+{
+	LCD_SetRotation(0);
+
+	LCD_Clear(LCD_COLOR_WHITE);
+
+	LCD_SetTextColor(LCD_COLOR_WHITE);
+
+	/* Slide a panel to the right by redrawing it */
+	uint32_t start = HAL_GetTick();
+
+	for (int16_t x = 0; x < 120; x += 2)
+	{
+		LCD_FillRect(x, 40, 2, 60);
+		drawPanel(x + 2, 40);
+	}
+
+	uint32_t redraw = HAL_GetTick() - start;
+
+	/* Slide it back by moving the pixels */
+	start = HAL_GetTick();
+
+	for (int16_t x = 122; x > 0; x -= 2)
+	{
+		LCD_CopyRect(x, 40, 100, 60, x - 2, 40);
+		LCD_SetTextColor(LCD_COLOR_WHITE);
+		LCD_FillRect(x + 98, 40, 2, 60);
+	}
+
+	printf("Slide 100x60 panel: redraw %lu ms, copy %lu ms\n", redraw, HAL_GetTick() - start);
+
+	HAL_Delay(1000);
+
+	/* Overlapping copies in every rotation */
+	for (uint8_t r = 0; r < 4; r++)
+	{
+		LCD_SetRotation(r);
+
+		LCD_Clear(LCD_COLOR_WHITE);
+
+		drawPanel(20, 20);
+
+		for (int16_t i = 0; i < 40; i++)
+		{
+			LCD_CopyRect(20 + i, 20 + i, 100, 60, 21 + i, 21 + i);
+		}
+
+		HAL_Delay(1000);
+	}
+}
+
 void demoChar()
 {
 	LCD_Clear(LCD_COLOR_WHITE);
@@ -279,6 +607,338 @@ void demoChar()
 	}
 }
 
+void demoTransparentText()
+{
+	LCD_SetFont(&Font20);
+
+	for (uint8_t r = 0; r < 4; r++)
+	{
+		LCD_SetRotation(r);
+
+		LCD_FillGradient(0, 0, LCD_GetWidth(), LCD_GetHeight(), LCD_COLOR_YELLOW, LCD_COLOR_DARKGREEN, VERTICAL_GRADIENT | DITHER_GRADIENT);
+
+		LCD_SetTextMode(TRANSPARENT_TEXT);
+
+		LCD_SetTextColor(LCD_COLOR_BLACK);
+		LCD_DisplayStringAt(11, 41, (uint8_t*) "Transparent", CENTER_MODE);
+		LCD_SetTextColor(LCD_COLOR_WHITE);
+		LCD_DisplayStringAt(10, 40, (uint8_t*) "Transparent", CENTER_MODE);
+
+		LCD_SetTextMode(OPAQUE_TEXT);
+
+		LCD_DisplayStringAt(10, 80, (uint8_t*) "Opaque", CENTER_MODE);
+
+		HAL_Delay(1000);
+	}
+}
+
+void demoMeasureString()
+{
+	const char *labels[] = { "OK", "Cancel", "Retry later" };
+
+	LCD_SetFont(&Font16);
+
+	for (uint8_t r = 0; r < 4; r++)
+	{
+		LCD_SetRotation(r);
+		LCD_Clear(LCD_COLOR_WHITE);
+
+		/* Buttons sized to their labels */
+		uint16_t y = 20;
+		for (uint8_t i = 0; i < 3; i++)
+		{
+			uint16_t w = LCD_MeasureString((uint8_t*) labels[i]) + 16;
+			uint16_t x = (LCD_GetWidth() - w) / 2;
+
+			LCD_SetTextColor(LCD_COLOR_LIGHTGRAY);
+			LCD_FillRect(x, y, w, LCD_GetFont()->Height + 8);
+			LCD_SetTextColor(LCD_COLOR_BLACK);
+			LCD_DrawRect(x, y, w, LCD_GetFont()->Height + 8);
+			LCD_SetBackColor(LCD_COLOR_LIGHTGRAY);
+			LCD_DisplayStringAt(x + 8, y + 4, (uint8_t*) labels[i], LEFT_MODE);
+
+			y += LCD_GetFont()->Height + 16;
+		}
+		LCD_SetBackColor(LCD_COLOR_WHITE);
+
+		HAL_Delay(1000);
+	}
+}
+
+void benchGlyphCache()
+{
+	LCD_SetRotation(0);
+	LCD_SetFont(&Font16);
+	LCD_SetTextColor(LCD_COLOR_GREEN);
+	LCD_SetBackColor(LCD_COLOR_BLACK);
+	LCD_Clear(LCD_COLOR_BLACK);
+	LCD_ClearGlyphCache();
+
+	/* Dashboard readouts redrawn over and over, formatted without printf */
+	LCD_DisplayStringAt(75, 40, (uint8_t*) " V", LEFT_MODE);
+	LCD_DisplayStringAt(75, 70, (uint8_t*) " rpm", LEFT_MODE);
+	LCD_DisplayStringAt(20, 100, (uint8_t*) "0x", LEFT_MODE);
+
+	uint32_t start = HAL_GetTick();
+
+	for (uint16_t i = 0; i < 500; i++)
+	{
+		LCD_DrawFixed(20, 40, (i * 71) % 2500, 1, 5, RIGHT_SPACE_PAD);
+		LCD_DrawInt(20, 70, (i * 13) % 6000, 5, RIGHT_SPACE_PAD);
+		LCD_DrawHex(42, 100, i * 0x1F3, 4, RIGHT_ZERO_PAD);
+	}
+
+	uint32_t hits, misses;
+	LCD_GetGlyphCacheStats(&hits, &misses);
+	printf("Glyph cache: %lu ms, %lu hits, %lu misses\n", HAL_GetTick() - start, hits, misses);
+
+	LCD_SetBackColor(LCD_COLOR_WHITE);
+}
+
+void demoTextField()
+{
+	LCD_SetRotation(0);
+	LCD_SetFont(&Font24);
+	LCD_SetTextColor(LCD_COLOR_YELLOW);
+	LCD_SetBackColor(LCD_COLOR_DARKBLUE);
+	LCD_Clear(LCD_COLOR_DARKBLUE);
+
+	TextField clock, counter;
+	LCD_InitTextField(&clock, 20, 40);
+	LCD_InitTextField(&counter, 20, 80);
+
+	/* Only the digits that change are sent to the display */
+	uint8_t text[NUMBER_BUFFER_SIZE + 4];
+	for (uint16_t i = 0; i < 600; i++)
+	{
+		/* MM:SS.T, the seconds in tenths as a fixed point number */
+		uint16_t size = LCD_FormatInt(text, i / 600, 2, RIGHT_ZERO_PAD);
+		text[size++] = ':';
+		LCD_FormatFixed(text + size, i % 600, 1, 4, RIGHT_ZERO_PAD);
+		LCD_UpdateTextField(&clock, text);
+		LCD_FormatInt(text, (i * 37) % 1200, 0, RIGHT_SPACE_PAD);
+		LCD_UpdateTextField(&counter, text);
+		HAL_Delay(10);
+	}
+
+	LCD_SetBackColor(LCD_COLOR_WHITE);
+}
+
+void demoTextScale()
+{
+	LCD_SetRotation(0);
+	LCD_SetFont(&Font16);
+	LCD_SetTextColor(LCD_COLOR_WHITE);
+	LCD_SetBackColor(LCD_COLOR_BLACK);
+	LCD_Clear(LCD_COLOR_BLACK);
+
+	/* Large numerals from the Font16 table, no extra font in flash */
+	for (uint8_t scale = 1; scale <= 4; scale++)
+	{
+		LCD_SetTextScale(scale);
+		LCD_DrawFixed(10, 10 + 16 * (scale - 1) * scale / 2, 1234 * scale, 1, 5, RIGHT_SPACE_PAD);
+	}
+
+	LCD_SetTextScale(1);
+	HAL_Delay(1000);
+
+	LCD_SetBackColor(LCD_COLOR_WHITE);
+}
+
+void demoTextBox()
+{
+	LCD_SetRotation(0);
+	LCD_SetFont(&Font12);
+	LCD_SetTextColor(LCD_COLOR_BLACK);
+	LCD_SetBackColor(LCD_COLOR_LIGHTYELLOW);
+	LCD_Clear(LCD_COLOR_WHITE);
+
+	/* Paragraph wrapped between words and centered */
+	Rect note = { 20, 10, 200, 100 };
+	LCD_DrawTextBox(&note, (uint8_t*) "Text boxes break long lines between words.\n"
+			"Anything outside of the box is clipped.", CENTER_MODE, WORD_WRAP, 0);
+
+	/* Log, new lines scroll the older ones up */
+	TextBox log;
+	LCD_InitTextBox(&log, 20, 130, 200, 120);
+	LCD_SetBackColor(LCD_COLOR_BLACK);
+	LCD_SetTextColor(LCD_COLOR_BLACK);
+	LCD_FillRect(20, 130, 200, 120);
+	LCD_SetTextColor(LCD_COLOR_GREEN);
+
+	uint8_t line[] = "Event 0 logged";
+	for (uint8_t i = 0; i < 30; i++)
+	{
+		line[6] = '0' + i % 10;
+		LCD_AppendTextBox(&log, line, LEFT_MODE, WORD_WRAP);
+		HAL_Delay(100);
+	}
+
+	LCD_SetBackColor(LCD_COLOR_WHITE);
+}
+
+void demoVerticalText()
+{
+	LCD_SetRotation(1);
+	LCD_SetFont(&Font12);
+	LCD_SetTextColor(LCD_COLOR_BLACK);
+	LCD_SetBackColor(LCD_COLOR_WHITE);
+	LCD_Clear(LCD_COLOR_WHITE);
+
+	/* Chart axes with a label along each vertical axis */
+	LCD_DrawVLine(40, 20, 180);
+	LCD_DrawVLine(280, 20, 180);
+	LCD_DrawHLine(40, 200, 241);
+
+	LCD_DisplayStringVertical(20, 60, (uint8_t*) "Voltage [V]", BOTTOM_TO_TOP);
+	LCD_DisplayStringVertical(288, 60, (uint8_t*) "Current [A]", TOP_TO_BOTTOM);
+	LCD_DisplayStringAt(0, 210, (uint8_t*) "Time [s]", CENTER_MODE);
+
+	HAL_Delay(1000);
+
+	LCD_SetRotation(0);
+}
+
+static void drawPanels()
+{
+	LCD_SetTextColor(LCD_COLOR_WHITE);
+	LCD_FillRect(0, 0, LCD_GetWidth(), LCD_GetHeight());
+
+	/* Overlapping panels, most pixels are drawn more than once */
+	for (int16_t i = 0; i < 8; i++)
+	{
+		drawPanel(10 + i * 15, 10 + i * 35);
+	}
+}
+
+void benchScene()
+{
+	LCD_SetRotation(0);
+
+	uint32_t start = HAL_GetTick();
+
+	drawPanels();
+
+	uint32_t direct = HAL_GetTick() - start;
+
+	HAL_Delay(1000);
+
+	/* Each pixel of the screen is sent once */
+	start = HAL_GetTick();
+
+	LCD_DrawScene(NULL, drawPanels);
+
+	printf("Panels: direct %lu ms, banded %lu ms\n", direct, HAL_GetTick() - start);
+
+	HAL_Delay(1000);
+}
+
+static uint16_t barLevels[6];
+
+static void drawBars(const Rect *pArea)
+{
+	(void)pArea;
+
+	LCD_SetTextColor(LCD_COLOR_WHITE);
+	LCD_FillRect(0, 0, LCD_GetWidth(), LCD_GetHeight());
+
+	for (uint8_t i = 0; i < 6; i++)
+	{
+		LCD_SetTextColor(LCD_COLOR_LIGHTGRAY);
+		LCD_FillRect(20 + i * 35, 60, 25, 200 - barLevels[i]);
+		LCD_SetTextColor(LCD_COLOR_BLUE);
+		LCD_FillRect(20 + i * 35, 260 - barLevels[i], 25, barLevels[i]);
+		LCD_DrawInt(20 + i * 35, 270, barLevels[i], 3, RIGHT_SPACE_PAD);
+	}
+}
+
+void demoDirtyRects()
+{
+	LCD_SetRotation(0);
+	LCD_SetFont(&Font8);
+	LCD_SetBackColor(LCD_COLOR_WHITE);
+
+	/* Whole screen redrawn whenever a bar changes */
+	uint32_t start = HAL_GetTick();
+
+	for (uint16_t n = 0; n < 100; n++)
+	{
+		barLevels[n % 6] = (n * 37) % 200;
+		drawBars(NULL);
+	}
+
+	uint32_t full = HAL_GetTick() - start;
+
+	/* Only the changed bar and its label */
+	start = HAL_GetTick();
+
+	for (uint16_t n = 0; n < 100; n++)
+	{
+		barLevels[n % 6] = (n * 73) % 200;
+		LCD_Invalidate(20 + (n % 6) * 35, 60, 25, 220);
+		LCD_FlushDirty(drawBars);
+	}
+
+	printf("Bars x100: full %lu ms, dirty %lu ms\n", full, HAL_GetTick() - start);
+
+	HAL_Delay(1000);
+}
+
+static const ListCommand dashboard[] =
+{
+	LIST_TEXT_COLOR(LCD_COLOR_WHITE),
+	LIST_FILL_RECT(0, 0, 240, 320),
+	LIST_TEXT_COLOR(LCD_COLOR_DARKBLUE),
+	LIST_FILL_RECT(0, 0, 240, 30),
+	LIST_FONT(&Font16),
+	LIST_TEXT_COLOR(LCD_COLOR_WHITE),
+	LIST_BACK_COLOR(LCD_COLOR_DARKBLUE),
+	LIST_TEXT(0, 7, "Dashboard", CENTER_MODE),
+	LIST_TEXT_COLOR(LCD_COLOR_LIGHTGRAY),
+	LIST_FILL_ROUND_RECT(20, 50, 200, 120, 10),
+	LIST_FILL_ROUND_RECT(20, 190, 200, 110, 10),
+	LIST_TEXT_COLOR(LCD_COLOR_GRAY),
+	LIST_LINE(30, 110, 210, 110),
+	LIST_LINE(120, 60, 120, 160),
+	LIST_RECT(30, 200, 180, 90),
+};
+
+static int16_t markerX, markerY;
+
+static void drawDashboard(const Rect *pArea)
+{
+	(void)pArea;
+
+	/* LCD_FlushDirty() already clips to the region */
+	LCD_ReplayList(dashboard, sizeof(dashboard) / sizeof(dashboard[0]), NULL);
+
+	LCD_SetTextColor(LCD_COLOR_RED);
+	LCD_FillCircle(markerX, markerY, 6);
+}
+
+void demoDisplayList()
+{
+	LCD_SetRotation(0);
+
+	markerX = 30;
+	markerY = 110;
+	LCD_Invalidate(0, 0, LCD_GetWidth(), LCD_GetHeight());
+	LCD_FlushDirty(drawDashboard);
+
+	/* Move a marker over the static layout, only its old and new spots are redrawn */
+	for (int16_t i = 0; i < 180; i += 2)
+	{
+		LCD_Invalidate(markerX - 6, markerY - 6, 13, 13);
+		markerX = 30 + i;
+		markerY = 110 - (i % 60) + 30;
+		LCD_Invalidate(markerX - 6, markerY - 6, 13, 13);
+		LCD_FlushDirty(drawDashboard);
+		HAL_Delay(20);
+	}
+
+	HAL_Delay(1000);
+}
+
 void demoImage()
 {
 	for (uint8_t r = 0; r < 4; r++)
@@ -361,8 +1021,42 @@ void appMain()
 
 		demoFilledCircles();
 
+		benchEllipses();
+
+		demoFilledPolygons();
+
+		demoAALines();
+
+		demoRoundShapes();
+
+		demoGradients();
+
+		benchBatchRects();
+
+		benchCopyRect();
+
 		demoChar();
 
+		demoTransparentText();
+
+		demoMeasureString();
+
+		benchGlyphCache();
+
+		demoTextField();
+
+		demoTextScale();
+
+		demoTextBox();
+
+		demoVerticalText();
+
+		benchScene();
+
+		demoDirtyRects();
+
+		demoDisplayList();
+
 		demoImage();
 
 		demoTouch();
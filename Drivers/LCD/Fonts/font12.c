@@ -38,1427 +38,316 @@
 /* Includes ------------------------------------------------------------------*/
 #include "fonts.h"
 
-/** @addtogroup Utilities
-  * @{
-  */
-  
-/** @addtogroup STM32_EVAL
-  * @{
-  */ 
-
-/** @addtogroup Common
-  * @{
-  */
-
-/** @addtogroup FONTS
-  * @brief      This file provides text Font12 for STM32xx-EVAL's LCD driver.
-  * @{
-  */  
-
-/** @defgroup FONTS_Private_Types
-  * @{
-  */ 
-/**
-  * @}
-  */ 
-
-
-/** @defgroup FONTS_Private_Defines
-  * @{
-  */
-/**
-  * @}
-  */ 
-
-
-/** @defgroup FONTS_Private_Macros
-  * @{
-  */
-/**
-  * @}
-  */ 
-  
-
-/** @defgroup FONTS_Private_Variables
-  * @{
-  */
 // 
 //  Font data for Courier New 12pt
+//  Packed by Tools/fontconv.py: glyph boxes as bit streams, rows unpadded
 // 
 
 const uint8_t Font12_Table[] = 
 {
-	// @0 ' ' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @12 '!' (7 pixels wide)
-	0x00, //        
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x00, //        
-	0x00, //        
-	0x10, //    #   
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @24 '"' (7 pixels wide)
-	0x00, //        
-	0x6C, //  ## ## 
-	0x48, //  #  #  
-	0x48, //  #  #  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @36 '#' (7 pixels wide)
-	0x00, //        
-	0x14, //    # # 
-	0x14, //    # # 
-	0x28, //   # #  
-	0x7C, //  ##### 
-	0x28, //   # #  
-	0x7C, //  ##### 
-	0x28, //   # #  
-	0x50, //  # #   
-	0x50, //  # #   
-	0x00, //        
-	0x00, //        
-
-	// @48 '$' (7 pixels wide)
-	0x00, //        
-	0x10, //    #   
-	0x38, //   ###  
-	0x40, //  #     
-	0x40, //  #     
-	0x38, //   ###  
-	0x48, //  #  #  
-	0x70, //  ###   
-	0x10, //    #   
-	0x10, //    #   
-	0x00, //        
-	0x00, //        
-
-	// @60 '%' (7 pixels wide)
-	0x00, //        
-	0x20, //   #    
-	0x50, //  # #   
-	0x20, //   #    
-	0x0C, //     ## 
-	0x70, //  ###   
-	0x08, //     #  
-	0x14, //    # # 
-	0x08, //     #  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @72 '&' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x18, //    ##  
-	0x20, //   #    
-	0x20, //   #    
-	0x54, //  # # # 
-	0x48, //  #  #  
-	0x34, //   ## # 
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @84 ''' (7 pixels wide)
-	0x00, //        
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @96 '(' (7 pixels wide)
-	0x00, //        
-	0x08, //     #  
-	0x08, //     #  
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x08, //     #  
-	0x08, //     #  
-	0x00, //        
-
-	// @108 ')' (7 pixels wide)
-	0x00, //        
-	0x20, //   #    
-	0x20, //   #    
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x20, //   #    
-	0x20, //   #    
-	0x00, //        
-
-	// @120 '*' (7 pixels wide)
-	0x00, //        
-	0x10, //    #   
-	0x7C, //  ##### 
-	0x10, //    #   
-	0x28, //   # #  
-	0x28, //   # #  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @132 '+' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0xFE, // #######
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @144 ',' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x18, //    ##  
-	0x10, //    #   
-	0x30, //   ##   
-	0x20, //   #    
-	0x00, //        
-
-	// @156 '-' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x7C, //  ##### 
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @168 '.' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x30, //   ##   
-	0x30, //   ##   
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @180 '/' (7 pixels wide)
-	0x00, //        
-	0x04, //      # 
-	0x04, //      # 
-	0x08, //     #  
-	0x08, //     #  
-	0x10, //    #   
-	0x10, //    #   
-	0x20, //   #    
-	0x20, //   #    
-	0x40, //  #     
-	0x00, //        
-	0x00, //        
-
-	// @192 '0' (7 pixels wide)
-	0x00, //        
-	0x38, //   ###  
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x38, //   ###  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @204 '1' (7 pixels wide)
-	0x00, //        
-	0x30, //   ##   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x7C, //  ##### 
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @216 '2' (7 pixels wide)
-	0x00, //        
-	0x38, //   ###  
-	0x44, //  #   # 
-	0x04, //      # 
-	0x08, //     #  
-	0x10, //    #   
-	0x20, //   #    
-	0x44, //  #   # 
-	0x7C, //  ##### 
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @228 '3' (7 pixels wide)
-	0x00, //        
-	0x38, //   ###  
-	0x44, //  #   # 
-	0x04, //      # 
-	0x18, //    ##  
-	0x04, //      # 
-	0x04, //      # 
-	0x44, //  #   # 
-	0x38, //   ###  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @240 '4' (7 pixels wide)
-	0x00, //        
-	0x0C, //     ## 
-	0x14, //    # # 
-	0x14, //    # # 
-	0x24, //   #  # 
-	0x44, //  #   # 
-	0x7E, //  ######
-	0x04, //      # 
-	0x0E, //     ###
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @252 '5' (7 pixels wide)
-	0x00, //        
-	0x3C, //   #### 
-	0x20, //   #    
-	0x20, //   #    
-	0x38, //   ###  
-	0x04, //      # 
-	0x04, //      # 
-	0x44, //  #   # 
-	0x38, //   ###  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @264 '6' (7 pixels wide)
-	0x00, //        
-	0x1C, //    ### 
-	0x20, //   #    
-	0x40, //  #     
-	0x78, //  ####  
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x38, //   ###  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @276 '7' (7 pixels wide)
-	0x00, //        
-	0x7C, //  ##### 
-	0x44, //  #   # 
-	0x04, //      # 
-	0x08, //     #  
-	0x08, //     #  
-	0x08, //     #  
-	0x10, //    #   
-	0x10, //    #   
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @288 '8' (7 pixels wide)
-	0x00, //        
-	0x38, //   ###  
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x38, //   ###  
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x38, //   ###  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @300 '9' (7 pixels wide)
-	0x00, //        
-	0x38, //   ###  
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x3C, //   #### 
-	0x04, //      # 
-	0x08, //     #  
-	0x70, //  ###   
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @312 ':' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x30, //   ##   
-	0x30, //   ##   
-	0x00, //        
-	0x00, //        
-	0x30, //   ##   
-	0x30, //   ##   
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @324 ';' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x18, //    ##  
-	0x18, //    ##  
-	0x00, //        
-	0x00, //        
-	0x18, //    ##  
-	0x30, //   ##   
-	0x20, //   #    
-	0x00, //        
-	0x00, //        
-
-	// @336 '<' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x0C, //     ## 
-	0x10, //    #   
-	0x60, //  ##    
-	0x80, // #      
-	0x60, //  ##    
-	0x10, //    #   
-	0x0C, //     ## 
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @348 '=' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x7C, //  ##### 
-	0x00, //        
-	0x7C, //  ##### 
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @360 '>' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0xC0, // ##     
-	0x20, //   #    
-	0x18, //    ##  
-	0x04, //      # 
-	0x18, //    ##  
-	0x20, //   #    
-	0xC0, // ##     
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @372 '?' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x18, //    ##  
-	0x24, //   #  # 
-	0x04, //      # 
-	0x08, //     #  
-	0x10, //    #   
-	0x00, //        
-	0x30, //   ##   
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @384 '@' (7 pixels wide)
-	0x38, //   ###  
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x4C, //  #  ## 
-	0x54, //  # # # 
-	0x54, //  # # # 
-	0x4C, //  #  ## 
-	0x40, //  #     
-	0x44, //  #   # 
-	0x38, //   ###  
-	0x00, //        
-	0x00, //        
-
-	// @396 'A' (7 pixels wide)
-	0x00, //        
-	0x30, //   ##   
-	0x10, //    #   
-	0x28, //   # #  
-	0x28, //   # #  
-	0x28, //   # #  
-	0x7C, //  ##### 
-	0x44, //  #   # 
-	0xEE, // ### ###
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @408 'B' (7 pixels wide)
-	0x00, //        
-	0xF8, // #####  
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x78, //  ####  
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0xF8, // #####  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @420 'C' (7 pixels wide)
-	0x00, //        
-	0x3C, //   #### 
-	0x44, //  #   # 
-	0x40, //  #     
-	0x40, //  #     
-	0x40, //  #     
-	0x40, //  #     
-	0x44, //  #   # 
-	0x38, //   ###  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @432 'D' (7 pixels wide)
-	0x00, //        
-	0xF0, // ####   
-	0x48, //  #  #  
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x48, //  #  #  
-	0xF0, // ####   
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @444 'E' (7 pixels wide)
-	0x00, //        
-	0xFC, // ###### 
-	0x44, //  #   # 
-	0x50, //  # #   
-	0x70, //  ###   
-	0x50, //  # #   
-	0x40, //  #     
-	0x44, //  #   # 
-	0xFC, // ###### 
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @456 'F' (7 pixels wide)
-	0x00, //        
-	0x7E, //  ######
-	0x22, //   #   #
-	0x28, //   # #  
-	0x38, //   ###  
-	0x28, //   # #  
-	0x20, //   #    
-	0x20, //   #    
-	0x70, //  ###   
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @468 'G' (7 pixels wide)
-	0x00, //        
-	0x3C, //   #### 
-	0x44, //  #   # 
-	0x40, //  #     
-	0x40, //  #     
-	0x4E, //  #  ###
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x38, //   ###  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @480 'H' (7 pixels wide)
-	0x00, //        
-	0xEE, // ### ###
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x7C, //  ##### 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0xEE, // ### ###
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @492 'I' (7 pixels wide)
-	0x00, //        
-	0x7C, //  ##### 
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x7C, //  ##### 
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @504 'J' (7 pixels wide)
-	0x00, //        
-	0x3C, //   #### 
-	0x08, //     #  
-	0x08, //     #  
-	0x08, //     #  
-	0x48, //  #  #  
-	0x48, //  #  #  
-	0x48, //  #  #  
-	0x30, //   ##   
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @516 'K' (7 pixels wide)
-	0x00, //        
-	0xEE, // ### ###
-	0x44, //  #   # 
-	0x48, //  #  #  
-	0x50, //  # #   
-	0x70, //  ###   
-	0x48, //  #  #  
-	0x44, //  #   # 
-	0xE6, // ###  ##
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @528 'L' (7 pixels wide)
-	0x00, //        
-	0x70, //  ###   
-	0x20, //   #    
-	0x20, //   #    
-	0x20, //   #    
-	0x20, //   #    
-	0x24, //   #  # 
-	0x24, //   #  # 
-	0x7C, //  ##### 
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @540 'M' (7 pixels wide)
-	0x00, //        
-	0xEE, // ### ###
-	0x6C, //  ## ## 
-	0x6C, //  ## ## 
-	0x54, //  # # # 
-	0x54, //  # # # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0xEE, // ### ###
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @552 'N' (7 pixels wide)
-	0x00, //        
-	0xEE, // ### ###
-	0x64, //  ##  # 
-	0x64, //  ##  # 
-	0x54, //  # # # 
-	0x54, //  # # # 
-	0x54, //  # # # 
-	0x4C, //  #  ## 
-	0xEC, // ### ## 
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @564 'O' (7 pixels wide)
-	0x00, //        
-	0x38, //   ###  
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x38, //   ###  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @576 'P' (7 pixels wide)
-	0x00, //        
-	0x78, //  ####  
-	0x24, //   #  # 
-	0x24, //   #  # 
-	0x24, //   #  # 
-	0x38, //   ###  
-	0x20, //   #    
-	0x20, //   #    
-	0x70, //  ###   
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @588 'Q' (7 pixels wide)
-	0x00, //        
-	0x38, //   ###  
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x38, //   ###  
-	0x1C, //    ### 
-	0x00, //        
-	0x00, //        
-
-	// @600 'R' (7 pixels wide)
-	0x00, //        
-	0xF8, // #####  
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x78, //  ####  
-	0x48, //  #  #  
-	0x44, //  #   # 
-	0xE2, // ###   #
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @612 'S' (7 pixels wide)
-	0x00, //        
-	0x34, //   ## # 
-	0x4C, //  #  ## 
-	0x40, //  #     
-	0x38, //   ###  
-	0x04, //      # 
-	0x04, //      # 
-	0x64, //  ##  # 
-	0x58, //  # ##  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @624 'T' (7 pixels wide)
-	0x00, //        
-	0xFE, // #######
-	0x92, // #  #  #
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x38, //   ###  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @636 'U' (7 pixels wide)
-	0x00, //        
-	0xEE, // ### ###
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x38, //   ###  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @648 'V' (7 pixels wide)
-	0x00, //        
-	0xEE, // ### ###
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x28, //   # #  
-	0x28, //   # #  
-	0x28, //   # #  
-	0x10, //    #   
-	0x10, //    #   
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @660 'W' (7 pixels wide)
-	0x00, //        
-	0xEE, // ### ###
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x54, //  # # # 
-	0x54, //  # # # 
-	0x54, //  # # # 
-	0x54, //  # # # 
-	0x28, //   # #  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @672 'X' (7 pixels wide)
-	0x00, //        
-	0xC6, // ##   ##
-	0x44, //  #   # 
-	0x28, //   # #  
-	0x10, //    #   
-	0x10, //    #   
-	0x28, //   # #  
-	0x44, //  #   # 
-	0xC6, // ##   ##
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @684 'Y' (7 pixels wide)
-	0x00, //        
-	0xEE, // ### ###
-	0x44, //  #   # 
-	0x28, //   # #  
-	0x28, //   # #  
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x38, //   ###  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @696 'Z' (7 pixels wide)
-	0x00, //        
-	0x7C, //  ##### 
-	0x44, //  #   # 
-	0x08, //     #  
-	0x10, //    #   
-	0x10, //    #   
-	0x20, //   #    
-	0x44, //  #   # 
-	0x7C, //  ##### 
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @708 '[' (7 pixels wide)
-	0x00, //        
-	0x38, //   ###  
-	0x20, //   #    
-	0x20, //   #    
-	0x20, //   #    
-	0x20, //   #    
-	0x20, //   #    
-	0x20, //   #    
-	0x20, //   #    
-	0x20, //   #    
-	0x38, //   ###  
-	0x00, //        
-
-	// @720 '\' (7 pixels wide)
-	0x00, //        
-	0x40, //  #     
-	0x20, //   #    
-	0x20, //   #    
-	0x20, //   #    
-	0x10, //    #   
-	0x10, //    #   
-	0x08, //     #  
-	0x08, //     #  
-	0x08, //     #  
-	0x00, //        
-	0x00, //        
-
-	// @732 ']' (7 pixels wide)
-	0x00, //        
-	0x38, //   ###  
-	0x08, //     #  
-	0x08, //     #  
-	0x08, //     #  
-	0x08, //     #  
-	0x08, //     #  
-	0x08, //     #  
-	0x08, //     #  
-	0x08, //     #  
-	0x38, //   ###  
-	0x00, //        
-
-	// @744 '^' (7 pixels wide)
-	0x00, //        
-	0x10, //    #   
-	0x10, //    #   
-	0x28, //   # #  
-	0x44, //  #   # 
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @756 '_' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0xFE, // #######
-
-	// @768 '`' (7 pixels wide)
-	0x00, //        
-	0x10, //    #   
-	0x08, //     #  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @780 'a' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x38, //   ###  
-	0x44, //  #   # 
-	0x3C, //   #### 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x3E, //   #####
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @792 'b' (7 pixels wide)
-	0x00, //        
-	0xC0, // ##     
-	0x40, //  #     
-	0x58, //  # ##  
-	0x64, //  ##  # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0xF8, // #####  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @804 'c' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x3C, //   #### 
-	0x44, //  #   # 
-	0x40, //  #     
-	0x40, //  #     
-	0x44, //  #   # 
-	0x38, //   ###  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @816 'd' (7 pixels wide)
-	0x00, //        
-	0x0C, //     ## 
-	0x04, //      # 
-	0x34, //   ## # 
-	0x4C, //  #  ## 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x3E, //   #####
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @828 'e' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x38, //   ###  
-	0x44, //  #   # 
-	0x7C, //  ##### 
-	0x40, //  #     
-	0x40, //  #     
-	0x3C, //   #### 
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @840 'f' (7 pixels wide)
-	0x00, //        
-	0x1C, //    ### 
-	0x20, //   #    
-	0x7C, //  ##### 
-	0x20, //   #    
-	0x20, //   #    
-	0x20, //   #    
-	0x20, //   #    
-	0x7C, //  ##### 
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @852 'g' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x36, //   ## ##
-	0x4C, //  #  ## 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x3C, //   #### 
-	0x04, //      # 
-	0x38, //   ###  
-	0x00, //        
-
-	// @864 'h' (7 pixels wide)
-	0x00, //        
-	0xC0, // ##     
-	0x40, //  #     
-	0x58, //  # ##  
-	0x64, //  ##  # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0xEE, // ### ###
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @876 'i' (7 pixels wide)
-	0x00, //        
-	0x10, //    #   
-	0x00, //        
-	0x70, //  ###   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x7C, //  ##### 
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @888 'j' (7 pixels wide)
-	0x00, //        
-	0x10, //    #   
-	0x00, //        
-	0x78, //  ####  
-	0x08, //     #  
-	0x08, //     #  
-	0x08, //     #  
-	0x08, //     #  
-	0x08, //     #  
-	0x08, //     #  
-	0x70, //  ###   
-	0x00, //        
-
-	// @900 'k' (7 pixels wide)
-	0x00, //        
-	0xC0, // ##     
-	0x40, //  #     
-	0x5C, //  # ### 
-	0x48, //  #  #  
-	0x70, //  ###   
-	0x50, //  # #   
-	0x48, //  #  #  
-	0xDC, // ## ### 
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @912 'l' (7 pixels wide)
-	0x00, //        
-	0x30, //   ##   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x7C, //  ##### 
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @924 'm' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0xE8, // ### #  
-	0x54, //  # # # 
-	0x54, //  # # # 
-	0x54, //  # # # 
-	0x54, //  # # # 
-	0xFE, // #######
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @936 'n' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0xD8, // ## ##  
-	0x64, //  ##  # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0xEE, // ### ###
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @948 'o' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x38, //   ###  
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x38, //   ###  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @960 'p' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0xD8, // ## ##  
-	0x64, //  ##  # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x78, //  ####  
-	0x40, //  #     
-	0xE0, // ###    
-	0x00, //        
-
-	// @972 'q' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x36, //   ## ##
-	0x4C, //  #  ## 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x3C, //   #### 
-	0x04, //      # 
-	0x0E, //     ###
-	0x00, //        
-
-	// @984 'r' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x6C, //  ## ## 
-	0x30, //   ##   
-	0x20, //   #    
-	0x20, //   #    
-	0x20, //   #    
-	0x7C, //  ##### 
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @996 's' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x3C, //   #### 
-	0x44, //  #   # 
-	0x38, //   ###  
-	0x04, //      # 
-	0x44, //  #   # 
-	0x78, //  ####  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @1008 't' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x20, //   #    
-	0x7C, //  ##### 
-	0x20, //   #    
-	0x20, //   #    
-	0x20, //   #    
-	0x22, //   #   #
-	0x1C, //    ### 
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @1020 'u' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0xCC, // ##  ## 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x4C, //  #  ## 
-	0x36, //   ## ##
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @1032 'v' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0xEE, // ### ###
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x28, //   # #  
-	0x28, //   # #  
-	0x10, //    #   
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @1044 'w' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0xEE, // ### ###
-	0x44, //  #   # 
-	0x54, //  # # # 
-	0x54, //  # # # 
-	0x54, //  # # # 
-	0x28, //   # #  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @1056 'x' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0xCC, // ##  ## 
-	0x48, //  #  #  
-	0x30, //   ##   
-	0x30, //   ##   
-	0x48, //  #  #  
-	0xCC, // ##  ## 
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @1068 'y' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0xEE, // ### ###
-	0x44, //  #   # 
-	0x24, //   #  # 
-	0x28, //   # #  
-	0x18, //    ##  
-	0x10, //    #   
-	0x10, //    #   
-	0x78, //  ####  
-	0x00, //        
-
-	// @1080 'z' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x7C, //  ##### 
-	0x48, //  #  #  
-	0x10, //    #   
-	0x20, //   #    
-	0x44, //  #   # 
-	0x7C, //  ##### 
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @1092 '{' (7 pixels wide)
-	0x00, //        
-	0x08, //     #  
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x20, //   #    
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x08, //     #  
-	0x00, //        
-
-	// @1104 '|' (7 pixels wide)
-	0x00, //        
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x00, //        
-	0x00, //        
-
-	// @1116 '}' (7 pixels wide)
-	0x00, //        
-	0x20, //   #    
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x08, //     #  
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x20, //   #    
-	0x00, //        
+	// @0 ' ' (0x0)
+	// @0 '!' (1x8)
+	0xF9,
+	// @1 '"' (5x3)
+	0xDC, 0xA4,
+	// @3 '#' (5x9)
+	0x29, 0x55, 0xF5, 0x7D, 0x54, 0xA0,
+	// @9 '$' (4x9)
+	0x27, 0x88, 0x79, 0xE2, 0x20,
+	// @14 '%' (5x8)
+	0x45, 0x10, 0x3E, 0x08, 0xA2,
+	// @19 '&' (5x6)
+	0x32, 0x11, 0x59, 0x34,
+	// @23 '\'' (1x4)
+	0xF0,
+	// @24 '(' (2x10)
+	0x5A, 0xAA, 0x50,
+	// @27 ')' (2x10)
+	0xA5, 0x55, 0xA0,
+	// @30 '*' (5x5)
+	0x27, 0xC8, 0xA5, 0x00,
+	// @34 '+' (7x7)
+	0x10, 0x20, 0x47, 0xF1, 0x02, 0x04, 0x00,
+	// @41 ',' (3x4)
+	0x6B, 0x40,
+	// @43 '-' (5x1)
+	0xF8,
+	// @44 '.' (2x2)
+	0xF0,
+	// @45 '/' (5x9)
+	0x08, 0x44, 0x22, 0x11, 0x08, 0x80,
+	// @51 '0' (5x8)
+	0x74, 0x63, 0x18, 0xC6, 0x2E,
+	// @56 '1' (5x8)
+	0x61, 0x08, 0x42, 0x10, 0x9F,
+	// @61 '2' (5x8)
+	0x74, 0x42, 0x22, 0x22, 0x3F,
+	// @66 '3' (5x8)
+	0x74, 0x42, 0x60, 0x86, 0x2E,
+	// @71 '4' (6x8)
+	0x18, 0xA2, 0x92, 0x8B, 0xF0, 0x87,
+	// @77 '5' (5x8)
+	0x7A, 0x10, 0xE0, 0x86, 0x2E,
+	// @82 '6' (5x8)
+	0x3A, 0x21, 0xE8, 0xC6, 0x2E,
+	// @87 '7' (5x8)
+	0xFC, 0x42, 0x21, 0x08, 0x84,
+	// @92 '8' (5x8)
+	0x74, 0x62, 0xE8, 0xC6, 0x2E,
+	// @97 '9' (5x8)
+	0x74, 0x63, 0x17, 0x84, 0x5C,
+	// @102 ':' (2x6)
+	0xF0, 0xF0,
+	// @104 ';' (3x7)
+	0x6C, 0x07, 0xA0,
+	// @107 '<' (6x7)
+	0x0C, 0x46, 0x20, 0x60, 0x40, 0xC0,
+	// @113 '=' (5x3)
+	0xF8, 0x3E,
+	// @115 '>' (6x7)
+	0xC0, 0x81, 0x81, 0x18, 0x8C, 0x00,
+	// @121 '?' (4x7)
+	0x69, 0x12, 0x40, 0xC0,
+	// @125 '@' (5x10)
+	0x74, 0x63, 0x3A, 0xD6, 0x70, 0x8B, 0x80,
+	// @132 'A' (7x8)
+	0x30, 0x20, 0xA1, 0x42, 0x8F, 0x91, 0x77,
+	// @139 'B' (6x8)
+	0xF9, 0x14, 0x5E, 0x45, 0x14, 0x7E,
+	// @145 'C' (5x8)
+	0x7C, 0x61, 0x08, 0x42, 0x2E,
+	// @150 'D' (6x8)
+	0xF1, 0x24, 0x51, 0x45, 0x14, 0xBC,
+	// @156 'E' (6x8)
+	0xFD, 0x15, 0x1C, 0x51, 0x04, 0x7F,
+	// @162 'F' (6x8)
+	0xFD, 0x15, 0x1C, 0x51, 0x04, 0x38,
+	// @168 'G' (6x8)
+	0x7A, 0x28, 0x20, 0x9E, 0x28, 0x9C,
+	// @174 'H' (7x8)
+	0xEE, 0x89, 0x13, 0xE4, 0x48, 0x91, 0x77,
+	// @181 'I' (5x8)
+	0xF9, 0x08, 0x42, 0x10, 0x9F,
+	// @186 'J' (5x8)
+	0x78, 0x84, 0x29, 0x4A, 0x4C,
+	// @191 'K' (7x8)
+	0xEE, 0x89, 0x22, 0x87, 0x09, 0x11, 0x73,
+	// @198 'L' (5x8)
+	0xE2, 0x10, 0x84, 0x25, 0x3F,
+	// @203 'M' (7x8)
+	0xEE, 0xD9, 0xB2, 0xA5, 0x48, 0x91, 0x77,
+	// @210 'N' (7x8)
+	0xEE, 0xC9, 0x92, 0xA5, 0x4A, 0x93, 0x76,
+	// @217 'O' (5x8)
+	0x74, 0x63, 0x18, 0xC6, 0x2E,
+	// @222 'P' (5x8)
+	0xF2, 0x52, 0x97, 0x21, 0x1C,
+	// @227 'Q' (5x9)
+	0x74, 0x63, 0x18, 0xC6, 0x2E, 0x38,
+	// @233 'R' (7x8)
+	0xF8, 0x89, 0x12, 0x27, 0x89, 0x11, 0x71,
+	// @240 'S' (5x8)
+	0x6C, 0xE0, 0xE0, 0x87, 0x36,
+	// @245 'T' (7x8)
+	0xFF, 0x24, 0x40, 0x81, 0x02, 0x04, 0x1C,
+	// @252 'U' (7x8)
+	0xEE, 0x89, 0x12, 0x24, 0x48, 0x91, 0x1C,
+	// @259 'V' (7x8)
+	0xEE, 0x89, 0x11, 0x42, 0x85, 0x04, 0x08,
+	// @266 'W' (7x8)
+	0xEE, 0x89, 0x12, 0xA5, 0x4A, 0x95, 0x14,
+	// @273 'X' (7x8)
+	0xC6, 0x88, 0xA0, 0x81, 0x05, 0x11, 0x63,
+	// @280 'Y' (7x8)
+	0xEE, 0x88, 0xA1, 0x41, 0x02, 0x04, 0x1C,
+	// @287 'Z' (5x8)
+	0xFC, 0x44, 0x42, 0x22, 0x3F,
+	// @292 '[' (3x10)
+	0xF2, 0x49, 0x24, 0x9C,
+	// @296 '\\' (4x9)
+	0x84, 0x44, 0x22, 0x11, 0x10,
+	// @301 ']' (3x10)
+	0xE4, 0x92, 0x49, 0x3C,
+	// @305 '^' (5x4)
+	0x21, 0x15, 0x10,
+	// @308 '_' (7x1)
+	0xFE,
+	// @309 '`' (2x2)
+	0x90,
+	// @310 'a' (6x6)
+	0x72, 0x27, 0xA2, 0x89, 0xF0,
+	// @315 'b' (6x8)
+	0xC1, 0x05, 0x99, 0x45, 0x14, 0x7E,
+	// @321 'c' (5x6)
+	0x7C, 0x61, 0x08, 0xB8,
+	// @325 'd' (6x8)
+	0x18, 0x26, 0xA6, 0x8A, 0x28, 0x9F,
+	// @331 'e' (5x6)
+	0x74, 0x7F, 0x08, 0x3C,
+	// @335 'f' (5x8)
+	0x3A, 0x3E, 0x84, 0x21, 0x1F,
+	// @340 'g' (6x8)
+	0x6E, 0x68, 0xA2, 0x89, 0xE0, 0x9C,
+	// @346 'h' (7x8)
+	0xC0, 0x81, 0x63, 0x24, 0x48, 0x91, 0x77,
+	// @353 'i' (5x8)
+	0x20, 0x38, 0x42, 0x10, 0x9F,
+	// @358 'j' (4x10)
+	0x20, 0xF1, 0x11, 0x11, 0x1E,
+	// @363 'k' (6x8)
+	0xC1, 0x05, 0xD2, 0x71, 0x44, 0xB7,
+	// @369 'l' (5x8)
+	0x61, 0x08, 0x42, 0x10, 0x9F,
+	// @374 'm' (7x6)
+	0xE8, 0xA9, 0x52, 0xA5, 0x5F, 0xC0,
+	// @380 'n' (7x6)
+	0xD8, 0xC9, 0x12, 0x24, 0x5D, 0xC0,
+	// @386 'o' (5x6)
+	0x74, 0x63, 0x18, 0xB8,
+	// @390 'p' (6x8)
+	0xD9, 0x94, 0x51, 0x45, 0xE4, 0x38,
+	// @396 'q' (6x8)
+	0x6E, 0x68, 0xA2, 0x89, 0xE0, 0x87,
+	// @402 'r' (5x6)
+	0xDB, 0x10, 0x84, 0x7C,
+	// @406 's' (5x6)
+	0x7C, 0x5C, 0x18, 0xF8,
+	// @410 't' (6x7)
+	0x43, 0xE4, 0x10, 0x41, 0x13, 0x80,
+	// @416 'u' (7x6)
+	0xCC, 0x89, 0x12, 0x24, 0xC6, 0xC0,
+	// @422 'v' (7x6)
+	0xEE, 0x89, 0x11, 0x42, 0x82, 0x00,
+	// @428 'w' (7x6)
+	0xEE, 0x89, 0x52, 0xA5, 0x45, 0x00,
+	// @434 'x' (6x6)
+	0xCD, 0x23, 0x0C, 0x4B, 0x30,
+	// @439 'y' (7x8)
+	0xEE, 0x88, 0x91, 0x41, 0x82, 0x04, 0x3C,
+	// @446 'z' (5x6)
+	0xFC, 0x88, 0x88, 0xFC,
+	// @450 '{' (3x10)
+	0x29, 0x25, 0x12, 0x44,
+	// @454 '|' (1x9)
+	0xFF, 0x80,
+	// @456 '}' (3x10)
+	0x89, 0x24, 0x52, 0x50,
+	// @460 '~' (5x2)
+	0x4D, 0x80,
+};
 
-	// @1128 '~' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x24, //   #  # 
-	0x58, //  # ##  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
+const sGLYPH Font12_Glyphs[] = 
+{
+	/* Offset, Width, Height, Left, Top */
+	{    0,  0,  0,  0,  0 }, // ' '
+	{    0,  1,  8,  3,  1 }, // '!'
+	{    1,  5,  3,  1,  1 }, // '"'
+	{    3,  5,  9,  1,  1 }, // '#'
+	{    9,  4,  9,  1,  1 }, // '$'
+	{   14,  5,  8,  1,  1 }, // '%'
+	{   19,  5,  6,  1,  3 }, // '&'
+	{   23,  1,  4,  3,  1 }, // '\''
+	{   24,  2, 10,  3,  1 }, // '('
+	{   27,  2, 10,  2,  1 }, // ')'
+	{   30,  5,  5,  1,  1 }, // '*'
+	{   34,  7,  7,  0,  2 }, // '+'
+	{   41,  3,  4,  2,  7 }, // ','
+	{   43,  5,  1,  1,  5 }, // '-'
+	{   44,  2,  2,  2,  7 }, // '.'
+	{   45,  5,  9,  1,  1 }, // '/'
+	{   51,  5,  8,  1,  1 }, // '0'
+	{   56,  5,  8,  1,  1 }, // '1'
+	{   61,  5,  8,  1,  1 }, // '2'
+	{   66,  5,  8,  1,  1 }, // '3'
+	{   71,  6,  8,  1,  1 }, // '4'
+	{   77,  5,  8,  1,  1 }, // '5'
+	{   82,  5,  8,  1,  1 }, // '6'
+	{   87,  5,  8,  1,  1 }, // '7'
+	{   92,  5,  8,  1,  1 }, // '8'
+	{   97,  5,  8,  1,  1 }, // '9'
+	{  102,  2,  6,  2,  3 }, // ':'
+	{  104,  3,  7,  2,  3 }, // ';'
+	{  107,  6,  7,  0,  2 }, // '<'
+	{  113,  5,  3,  1,  4 }, // '='
+	{  115,  6,  7,  0,  2 }, // '>'
+	{  121,  4,  7,  2,  2 }, // '?'
+	{  125,  5, 10,  1,  0 }, // '@'
+	{  132,  7,  8,  0,  1 }, // 'A'
+	{  139,  6,  8,  0,  1 }, // 'B'
+	{  145,  5,  8,  1,  1 }, // 'C'
+	{  150,  6,  8,  0,  1 }, // 'D'
+	{  156,  6,  8,  0,  1 }, // 'E'
+	{  162,  6,  8,  1,  1 }, // 'F'
+	{  168,  6,  8,  1,  1 }, // 'G'
+	{  174,  7,  8,  0,  1 }, // 'H'
+	{  181,  5,  8,  1,  1 }, // 'I'
+	{  186,  5,  8,  1,  1 }, // 'J'
+	{  191,  7,  8,  0,  1 }, // 'K'
+	{  198,  5,  8,  1,  1 }, // 'L'
+	{  203,  7,  8,  0,  1 }, // 'M'
+	{  210,  7,  8,  0,  1 }, // 'N'
+	{  217,  5,  8,  1,  1 }, // 'O'
+	{  222,  5,  8,  1,  1 }, // 'P'
+	{  227,  5,  9,  1,  1 }, // 'Q'
+	{  233,  7,  8,  0,  1 }, // 'R'
+	{  240,  5,  8,  1,  1 }, // 'S'
+	{  245,  7,  8,  0,  1 }, // 'T'
+	{  252,  7,  8,  0,  1 }, // 'U'
+	{  259,  7,  8,  0,  1 }, // 'V'
+	{  266,  7,  8,  0,  1 }, // 'W'
+	{  273,  7,  8,  0,  1 }, // 'X'
+	{  280,  7,  8,  0,  1 }, // 'Y'
+	{  287,  5,  8,  1,  1 }, // 'Z'
+	{  292,  3, 10,  2,  1 }, // '['
+	{  296,  4,  9,  1,  1 }, // '\\'
+	{  301,  3, 10,  2,  1 }, // ']'
+	{  305,  5,  4,  1,  1 }, // '^'
+	{  308,  7,  1,  0, 11 }, // '_'
+	{  309,  2,  2,  3,  1 }, // '`'
+	{  310,  6,  6,  1,  3 }, // 'a'
+	{  315,  6,  8,  0,  1 }, // 'b'
+	{  321,  5,  6,  1,  3 }, // 'c'
+	{  325,  6,  8,  1,  1 }, // 'd'
+	{  331,  5,  6,  1,  3 }, // 'e'
+	{  335,  5,  8,  1,  1 }, // 'f'
+	{  340,  6,  8,  1,  3 }, // 'g'
+	{  346,  7,  8,  0,  1 }, // 'h'
+	{  353,  5,  8,  1,  1 }, // 'i'
+	{  358,  4, 10,  1,  1 }, // 'j'
+	{  363,  6,  8,  0,  1 }, // 'k'
+	{  369,  5,  8,  1,  1 }, // 'l'
+	{  374,  7,  6,  0,  3 }, // 'm'
+	{  380,  7,  6,  0,  3 }, // 'n'
+	{  386,  5,  6,  1,  3 }, // 'o'
+	{  390,  6,  8,  0,  3 }, // 'p'
+	{  396,  6,  8,  1,  3 }, // 'q'
+	{  402,  5,  6,  1,  3 }, // 'r'
+	{  406,  5,  6,  1,  3 }, // 's'
+	{  410,  6,  7,  1,  2 }, // 't'
+	{  416,  7,  6,  0,  3 }, // 'u'
+	{  422,  7,  6,  0,  3 }, // 'v'
+	{  428,  7,  6,  0,  3 }, // 'w'
+	{  434,  6,  6,  0,  3 }, // 'x'
+	{  439,  7,  8,  0,  3 }, // 'y'
+	{  446,  5,  6,  1,  3 }, // 'z'
+	{  450,  3, 10,  2,  1 }, // '{'
+	{  454,  1,  9,  3,  1 }, // '|'
+	{  456,  3, 10,  2,  1 }, // '}'
+	{  460,  5,  2,  1,  5 }, // '~'
 };
 
 sFONT Font12 = {
   Font12_Table,
   7, /* Width */
   12, /* Height */
+  Font12_Glyphs,
+  0, /* Monospaced */
+  0, /* No kerning */
+  0, /* Kerning pairs */
+  0, /* 0x20..0x7E */
+  0, /* Ranges */
+  31, /* Fallback '?' */
+  1, /* Bits per pixel */
 };
 
-/**
-  * @}
-  */ 
-
-
-/** @defgroup FONTS_Private_Function_Prototypes
-  * @{
-  */ 
-/**
-  * @}
-  */ 
-
-
-/** @defgroup FONTS_Private_Functions
-  * @{
-  */
-    
-/**
-  * @}
-  */
-  
-/**
-  * @}
-  */ 
-
-/**
-  * @}
-  */
-
-/**
-  * @}
-  */
-
-/**
-  * @}
-  */  
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
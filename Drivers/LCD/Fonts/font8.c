@@ -38,52 +38,9 @@
 /* Includes ------------------------------------------------------------------*/
 #include "fonts.h"
 
-/** @addtogroup Utilities
-  * @{
-  */
-  
-/** @addtogroup STM32_EVAL
-  * @{
-  */ 
-
-/** @addtogroup Common
-  * @{
-  */
-
-/** @addtogroup FONTS
-  * @brief      This file provides text Font8 for STM32xx-EVAL's LCD driver. 
-  * @{
-  */  
-
-/** @defgroup FONTS_Private_Types
-  * @{
-  */ 
-/**
-  * @}
-  */ 
-
-
-/** @defgroup FONTS_Private_Defines
-  * @{
-  */
-/**
-  * @}
-  */ 
-
-
-/** @defgroup FONTS_Private_Macros
-  * @{
-  */
-/**
-  * @}
-  */ 
-  
-
-/** @defgroup FONTS_Private_Variables
-  * @{
-  */
 // 
 //  Font data for Courier New 12pt
+//  Whole cells by Tools/fontconv.py: rows padded to bytes, packing would be larger
 // 
 
 const uint8_t Font8_Table[] = 
@@ -158,7 +115,7 @@ const uint8_t Font8_Table[] =
 	0x00, //      
 	0x00, //      
 
-	// @56 ''' (5 pixels wide)
+	// @56 '\'' (5 pixels wide)
 	0x20, //   #  
 	0x20, //   #  
 	0x20, //   #  
@@ -688,7 +645,7 @@ const uint8_t Font8_Table[] =
 	0x30, //   ## 
 	0x00, //      
 
-	// @480 '\' (5 pixels wide)
+	// @480 '\\' (5 pixels wide)
 	0x80, // #    
 	0x40, //  #   
 	0x40, //  #   
@@ -1043,42 +1000,14 @@ sFONT Font8 = {
   Font8_Table,
   5, /* Width */
   8, /* Height */
+  0, /* Whole cells, packing would not make this font smaller */
+  0, /* Monospaced */
+  0, /* No kerning */
+  0, /* Kerning pairs */
+  0, /* 0x20..0x7E */
+  0, /* Ranges */
+  31, /* Fallback '?' */
+  1, /* Bits per pixel */
 };
 
-/**
-  * @}
-  */ 
-
-
-/** @defgroup FONTS_Private_Function_Prototypes
-  * @{
-  */ 
-/**
-  * @}
-  */ 
-
-
-/** @defgroup FONTS_Private_Functions
-  * @{
-  */
-    
-/**
-  * @}
-  */
-  
-/**
-  * @}
-  */ 
-
-/**
-  * @}
-  */
-
-/**
-  * @}
-  */
-
-/**
-  * @}
-  */  
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
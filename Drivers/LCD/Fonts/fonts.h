@@ -65,11 +65,49 @@
 /** @defgroup FONTS_Exported_Types
   * @{
   */ 
+typedef struct _tGlyph
+{
+  uint16_t Offset;     /*!< First byte of the glyph bits in the font table */
+  uint8_t  Width;      /*!< Width of the box around the set pixels, 0 if none */
+  uint8_t  Height;     /*!< Height of the box around the set pixels */
+  int8_t   Left;       /*!< Box left edge from the pen position (left bearing) */
+  uint8_t  Top;        /*!< Box top edge from the top of the line */
+
+} sGLYPH;
+
+typedef struct _tKernPair
+{
+  uint16_t First;      /*!< Left character */
+  uint16_t Second;     /*!< Right character */
+  int8_t   Offset;     /*!< Added to the advance of the left character */
+
+} sKERNPAIR;
+
+typedef struct _tRange
+{
+  uint16_t First;      /*!< First character code of the block */
+  uint16_t Last;       /*!< Last character code of the block */
+  uint16_t Glyph;      /*!< Glyph index of the first character */
+
+} sRANGE;
+
 typedef struct _tFont
 {    
   const uint8_t *table;
   uint16_t Width;
   uint16_t Height;
+  const sGLYPH *glyphs; /*!< Packed glyph boxes, rows unpadded MSB first; NULL if the
+                             table holds whole cells, each row padded to bytes */
+  const uint8_t *advances; /*!< Per glyph advance of proportional fonts; NULL if every
+                                glyph advances by Width */
+  const sKERNPAIR *kerning; /*!< Kerning pairs sorted by First, then Second */
+  uint16_t kerningCount;
+  const sRANGE *ranges; /*!< Character code blocks sorted by First; NULL if the font
+                             covers 0x20..0x7E */
+  uint16_t rangeCount;
+  uint16_t fallback;    /*!< Glyph index drawn for characters missing in the font */
+  uint8_t bpp;          /*!< Bits per pixel of packed glyphs: 1, or 2 and 4 for
+                             anti-aliased fonts */
   
 } sFONT;
 
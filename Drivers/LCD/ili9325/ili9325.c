@@ -43,6 +43,7 @@ extern uint16_t LCD_IO_ReadReg(uint8_t Reg);
 extern void 	LCD_IO_WriteReg(uint8_t Reg, uint16_t Data);
 extern void 	LCD_IO_WriteRegN(uint8_t Reg, uint16_t Data, uint32_t Count);
 extern void 	LCD_IO_WriteRegArray(uint8_t Reg, uint16_t *pData, uint32_t Size);
+extern void 	LCD_IO_ReadRegArray(uint8_t Reg, uint16_t *pData, uint32_t Size);
 
 static uint8_t lcd_rotation = 0;
 
@@ -275,8 +276,11 @@ void ili9325_SetDisplayWindow(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint
 	if(Xpos >= ili9325_GetLcdPixelWidth() || Ypos >= ili9325_GetLcdPixelHeight())
 		return;
 
-	if (Xpos + Width > ili9325_GetLcdPixelWidth() || Ypos + Height > ili9325_GetLcdPixelHeight())
-		return;
+	/* Windows running off the screen are cut at its edge */
+	if (Xpos + Width > ili9325_GetLcdPixelWidth())
+		Width = ili9325_GetLcdPixelWidth() - Xpos;
+	if (Ypos + Height > ili9325_GetLcdPixelHeight())
+		Height = ili9325_GetLcdPixelHeight() - Ypos;
 
 	uint16_t x1 = 0;
 	uint16_t y1 = 0;
@@ -381,7 +385,8 @@ void ili9325_DrawHLine(int16_t Xpos, int16_t Ypos, uint16_t Length, uint16_t RGB
 		if (newLength <= 0) return;
 		Xpos = 0;
 	}
-    else if (Xpos + Length > ili9325_GetLcdPixelWidth())
+
+    if (Xpos + newLength > ili9325_GetLcdPixelWidth())
     {
     	newLength = ili9325_GetLcdPixelWidth() - Xpos;
     }
@@ -414,7 +419,8 @@ void ili9325_DrawVLine(int16_t Xpos, int16_t Ypos, uint16_t Length, uint16_t RGB
 		if (newLength <= 0) return;
 		Ypos = 0;
 	}
-    else if (Ypos + Length > ili9325_GetLcdPixelHeight())
+
+    if (Ypos + newLength > ili9325_GetLcdPixelHeight())
     {
     	newLength = ili9325_GetLcdPixelHeight() - Ypos;
     }
@@ -429,7 +435,7 @@ void ili9325_DrawVLine(int16_t Xpos, int16_t Ypos, uint16_t Length, uint16_t RGB
 	LCD_IO_WriteReg(LCD_REG_3, direction ^ 0b1000);
 
 	/* Write 16-bit GRAM Reg */
-	LCD_IO_WriteRegN(LCD_REG_34, RGBCode, Length);
+	LCD_IO_WriteRegN(LCD_REG_34, RGBCode, newLength);
 
 	// restore direction
 	LCD_IO_WriteReg(LCD_REG_3, direction);
@@ -478,6 +484,90 @@ void ili9325_DrawRGBImage(uint16_t Xpos, uint16_t Ypos, uint16_t *pdata, uint32_
 	LCD_IO_WriteRegArray(LCD_REG_34, pdata, Size);
 }
 
+/**
+ * @brief  Reads picture.
+ * @param  Xpos: Image X position in the LCD
+ * @param  Ypos: Image Y position in the LCD
+ * @param  pdata: picture buffer.
+ * @param  Size: Image size in the LCD
+ * @retval None
+ */
+void ili9325_ReadRGBImage(uint16_t Xpos, uint16_t Ypos, uint16_t *pdata, uint32_t Size)
+{
+	/* Set Cursor */
+	ili9325_SetCursor(Xpos, Ypos);
+
+	/* Read 16-bit GRAM Reg */
+	LCD_IO_ReadRegArray(LCD_REG_34, pdata, Size);
+}
+
+/**
+ * @brief  Writes pixels from the current GRAM address on.
+ * @param  pdata: picture buffer.
+ * @param  Size: Number of pixels
+ * @retval None
+ */
+void ili9325_WriteGRAM(uint16_t *pdata, uint32_t Size)
+{
+	/* Write 16-bit GRAM Reg */
+	LCD_IO_WriteRegArray(LCD_REG_34, pdata, Size);
+}
+
+/**
+ * @brief  Writes one color from the current GRAM address on.
+ * @param  RGBCode: the RGB color
+ * @param  Size: Number of pixels
+ * @retval None
+ */
+void ili9325_FillGRAM(uint16_t RGBCode, uint32_t Size)
+{
+	/* Write 16-bit GRAM Reg */
+	LCD_IO_WriteRegN(LCD_REG_34, RGBCode, Size);
+}
+
+/**
+ * @brief  Writes scattered pixels of one row.
+ * @param  Ypos: specifies the Y position.
+ * @param  pXpos: X positions of the pixels
+ * @param  Count: Number of pixels
+ * @param  RGBCode: the RGB color
+ * @retval None
+ */
+void ili9325_WriteRowPixels(uint16_t Ypos, uint16_t *pXpos, uint16_t Count, uint16_t RGBCode)
+{
+	uint16_t i = 0;
+
+	if(Count == 0)
+		return;
+
+	ili9325_SetCursor(pXpos[0], Ypos);
+	LCD_IO_WriteReg(LCD_REG_34, RGBCode);
+
+	/* Along a row only one of the address registers changes */
+	for(i = 1; i < Count; i++)
+	{
+		switch (lcd_rotation % 4)
+		{
+			case 0:
+				LCD_IO_WriteReg(LCD_REG_32, pXpos[i]);
+				break;
+			case 1:
+				LCD_IO_WriteReg(LCD_REG_33, ILI9325_LCD_PIXEL_HEIGHT - 1 - pXpos[i]);
+				break;
+			case 2:
+				LCD_IO_WriteReg(LCD_REG_32, ILI9325_LCD_PIXEL_WIDTH - 1 - pXpos[i]);
+				break;
+			case 3:
+				LCD_IO_WriteReg(LCD_REG_33, pXpos[i]);
+				break;
+			default:
+				break;
+		}
+
+		LCD_IO_WriteReg(LCD_REG_34, RGBCode);
+	}
+}
+
 LCD_DrvTypeDef ili9325_drv =
 {
 	ili9325_GetLcdPixelWidth,
@@ -495,6 +585,10 @@ LCD_DrvTypeDef ili9325_drv =
 	ili9325_DrawHLine,
 	ili9325_DrawVLine,
 	ili9325_DrawBitmap,
-	ili9325_DrawRGBImage
+	ili9325_DrawRGBImage,
+	ili9325_ReadRGBImage,
+	ili9325_WriteGRAM,
+	ili9325_FillGRAM,
+	ili9325_WriteRowPixels
 };
 
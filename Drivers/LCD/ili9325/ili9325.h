@@ -199,6 +199,10 @@ void     ili9325_DrawVLine(int16_t Xpos, int16_t Ypos, uint16_t Length, uint16_t
 
 void     ili9325_DrawBitmap(uint16_t Xpos, uint16_t Ypos, uint8_t *pbmp);
 void     ili9325_DrawRGBImage(uint16_t Xpos, uint16_t Ypos, uint16_t *pdata, uint32_t Size);
+void     ili9325_ReadRGBImage(uint16_t Xpos, uint16_t Ypos, uint16_t *pdata, uint32_t Size);
+void     ili9325_WriteGRAM(uint16_t *pdata, uint32_t Size);
+void     ili9325_FillGRAM(uint16_t RGBCode, uint32_t Size);
+void     ili9325_WriteRowPixels(uint16_t Ypos, uint16_t *pXpos, uint16_t Count, uint16_t RGBCode);
 
 
 /* LCD driver structure */
@@ -71,26 +71,254 @@
 #define POLY_X(Z)              ((int32_t)((Points + (Z))->X))
 #define POLY_Y(Z)              ((int32_t)((Points + (Z))->Y))
 
-#define MAX_HEIGHT_FONT         17
+/* Widest glyph row, rows of up to 3 bytes are read from the font table */
 #define MAX_WIDTH_FONT          24
-#define OFFSET_BITMAP           54
+
+/* Glyph pixels expanded before they are streamed, at least MAX_WIDTH_FONT */
+#ifndef GLYPH_BUFFER_SIZE
+#define GLYPH_BUFFER_SIZE       64
+#endif
+
+/* Character code of malformed UTF-8 and of characters beyond 0xFFFF */
+#define REPLACEMENT_CHAR        0xFFFD
 
 #define ABS(X)  ((X) > 0 ? (X) : -(X)) 
 
-#define LINE(x) ((x) * (((sFONT *)LCD_GetFont())->Height))
+/* Max number of vertices accepted by LCD_FillPolygon */
+#ifndef MAX_POLY_POINTS
+#define MAX_POLY_POINTS         32
+#endif
+
+/* Max depth of the clip rectangle stack */
+#ifndef MAX_CLIP_DEPTH
+#define MAX_CLIP_DEPTH          8
+#endif
+
+/* Current clip rectangle bounds, right and bottom are exclusive */
+#define CLIP_LEFT               ((int32_t)DrawProp.Clip.X)
+#define CLIP_TOP                ((int32_t)DrawProp.Clip.Y)
+#define CLIP_RIGHT              ((int32_t)DrawProp.Clip.X + DrawProp.Clip.Width)
+#define CLIP_BOTTOM             ((int32_t)DrawProp.Clip.Y + DrawProp.Clip.Height)
+
+/* Area completely outside of the clip rectangle */
+#define CLIP_OUT(X, Y, W, H)    ((X) >= CLIP_RIGHT || (Y) >= CLIP_BOTTOM || (X) + (W) <= CLIP_LEFT || (Y) + (H) <= CLIP_TOP)
+
+/* Number of anti-aliasing intensity levels, cached blend ramps and the longest run
+ * of anti-aliased pixels streamed through one window */
+#define AA_LEVELS               16
+#define AA_RAMPS                4
+#define AA_MAX_RUN              32
+
+/* Max number of rectangles or spans sorted and merged together */
+#ifndef MAX_BATCH_ITEMS
+#define MAX_BATCH_ITEMS         32
+#endif
+
+/* Pixels moved through RAM at once by LCD_CopyRect() */
+#ifndef COPY_BUFFER_SIZE
+#define COPY_BUFFER_SIZE        64
+#endif
+
+/* Shortest run of transparent text pixels drawn as a line, shorter ones
+ * are written pixel by pixel */
+#ifndef TEXT_RUN_MIN
+#define TEXT_RUN_MIN            2
+#endif
+
+/* Largest text magnification */
+#define MAX_TEXT_SCALE          4
+
+/* Pixels of the RAM band LCD_DrawScene() renders into, 0 compiles it out.
+ * Bands are as tall as fit, 8 rows of a portrait screen by default so that the
+ * band and the glyph cache together take about 9.5 KB of a 20 KB part */
+#ifndef BAND_BUFFER_SIZE
+#define BAND_BUFFER_SIZE        (240 * 8)
+#endif
+
+/* Regions LCD_Invalidate() keeps apart, more are merged into the cheapest */
+#ifndef MAX_DIRTY_RECTS
+#define MAX_DIRTY_RECTS         8
+#endif
+
+/* Cost of one more flushed region in pixels: its window and cursor setup and
+ * running the redraw callback once more. Two regions are merged when redrawing
+ * the box around them costs no more than that over their own pixels */
+#ifndef DIRTY_REGION_COST
+#define DIRTY_REGION_COST       1024
+#endif
+
+/* Opaque glyph cells kept in RGB565 for the glyph cache, 0 compiles it out.
+ * Each entry takes 2 * GLYPH_CACHE_PIXELS + 12 bytes of RAM, 5.8 KB for 16 */
+#ifndef GLYPH_CACHE_ENTRIES
+#define GLYPH_CACHE_ENTRIES     16
+#endif
+
+/* Largest cached cell (advance x font height). At 176 nothing larger than
+ * Font16 (11x16 cells) is cached, Font20 and Font24 text is always rendered
+ * from the font table; raise it to 280 or 408 to cache those as well */
+#ifndef GLYPH_CACHE_PIXELS
+#define GLYPH_CACHE_PIXELS      176
+#endif
+
+/* Longest run of gradient pixels computed before it is streamed */
+#define GRADIENT_RUN            32
+
+/* First pixel whose center is at or right of the 16.16 fixed point X */
+#define SPAN_START(X)           ((int16_t)(((X) + 0x7FFF) >> 16))
+
+#define LINE(x) ((x) * (((sFONT *)LCD_GetFont())->Height) * textScale)
 
 LCD_DrawPropTypeDef DrawProp;
 
 LCD_DrvTypeDef  *lcd_drv;
 
-/* Max size of bitmap will based on a font24 (17x24) */
-uint8_t bitmap[MAX_HEIGHT_FONT*MAX_WIDTH_FONT*2+OFFSET_BITMAP] = {0};
+/* Pushed clip rectangles, each one already intersected with the previous */
+static Rect clipStack[MAX_CLIP_DEPTH];
+static uint8_t clipDepth = 0;
+
+static uint8_t lcdRotation = 0;
+
+typedef struct
+{
+	int32_t X;        /* 16.16 x at the center of the current scanline */
+	int32_t Slope;    /* 16.16 x increment per scanline */
+	int16_t YMin;     /* first scanline */
+	int16_t YMax;     /* scanline after the last one */
+	int8_t  Dir;      /* winding direction */
+
+}PolyEdgeTypeDef;
+
+typedef struct
+{
+	uint16_t TextColor;
+	uint16_t BackColor;
+	uint16_t Color[AA_LEVELS];
+
+}AARampTypeDef;
+
+/* Blend ramps of the recently used (TextColor, BackColor) pairs */
+static AARampTypeDef aaRamps[AA_RAMPS];
+static uint8_t aaRampCount = 0, aaRampNext = 0;
+static AA_ModeTypdef aaMode = AA_BACKCOLOR_MODE;
+
+static Text_ModeTypdef textMode = OPAQUE_TEXT;
+static uint8_t textScale = 1;
+
+/* Intensities of the near and the far pixels of an anti-aliased run */
+static uint8_t aaLevels[2][AA_MAX_RUN];
+static uint16_t aaPixels[2 * AA_MAX_RUN];
+
+/* sin(0..90 degrees) in Q14 */
+static const uint16_t sinTable[91] =
+{
+	0, 286, 572, 857, 1143, 1428, 1713, 1997, 2280, 2563,
+	2845, 3126, 3406, 3686, 3964, 4240, 4516, 4790, 5063, 5334,
+	5604, 5872, 6138, 6402, 6664, 6924, 7182, 7438, 7692, 7943,
+	8192, 8438, 8682, 8923, 9162, 9397, 9630, 9860, 10087, 10311,
+	10531, 10749, 10963, 11174, 11381, 11585, 11786, 11982, 12176, 12365,
+	12551, 12733, 12911, 13085, 13255, 13421, 13583, 13741, 13894, 14044,
+	14189, 14330, 14466, 14598, 14726, 14849, 14968, 15082, 15191, 15296,
+	15396, 15491, 15582, 15668, 15749, 15826, 15897, 15964, 16026, 16083,
+	16135, 16182, 16225, 16262, 16294, 16322, 16344, 16362, 16374, 16382,
+	16384
+};
+
+/* Line buffer of LCD_CopyRect() */
+static uint16_t copyBuffer[COPY_BUFFER_SIZE];
+
+/* Glyph box of the current font as read by the text functions */
+typedef struct
+{
+	const uint8_t *pBits;   /* First row of the box */
+	uint16_t Stride;        /* Bits from one box row to the next */
+	uint8_t Width;          /* Box width, at most MAX_WIDTH_FONT */
+	uint8_t Height;         /* Box height */
+	int8_t Left;            /* Box left edge from the pen position */
+	uint8_t Top;            /* Box top edge from the top of the line */
+	uint8_t Advance;        /* Pen movement to the next character */
+	uint8_t Bpp;            /* Bits per pixel: 1, 2 or 4 */
+	uint8_t Scale;          /* Pixel value to AA level factor */
+	uint16_t Index;         /* Glyph index in the font */
+} GlyphTypeDef;
+
+#if GLYPH_CACHE_ENTRIES > 0
+typedef struct
+{
+	const sFONT *pFont;     /* NULL if the entry is free */
+	uint16_t Index;
+	uint16_t TextColor;
+	uint16_t BackColor;
+	uint32_t Used;          /* Stamp of the last use */
+	uint16_t Pixels[GLYPH_CACHE_PIXELS];
+
+}GlyphCacheTypeDef;
+
+/* Recently drawn glyph cells, the least recently used one is replaced */
+static GlyphCacheTypeDef glyphCache[GLYPH_CACHE_ENTRIES];
+static uint32_t glyphCacheClock = 0, glyphCacheHits = 0, glyphCacheMisses = 0;
+#endif
+
+#if BAND_BUFFER_SIZE > 0
+typedef struct
+{
+	LCD_DrvTypeDef *pTarget;  /* Display driver the bands are sent to */
+	Rect Area;                /* Band on the screen in the scene rotation */
+	uint16_t ScreenWidth;     /* Screen size in the scene rotation */
+	uint16_t ScreenHeight;
+	uint8_t Rotation;         /* Rotation of the scene */
+	uint8_t Turn;             /* Rotation last set through the band driver */
+	int32_t WinX1, WinY1, WinX2, WinY2; /* Window, last row and column included */
+	int32_t CurX, CurY;       /* Address counter */
+
+}BandTypeDef;
+
+/* Scene band being rendered and the driver that draws into it */
+static BandTypeDef band;
+static uint16_t bandPixels[BAND_BUFFER_SIZE];
+static LCD_DrvTypeDef bandDrv;
+#endif
+
+/* Regions waiting for LCD_FlushDirty(), and the one being redrawn */
+static Rect dirtyRects[MAX_DIRTY_RECTS];
+static uint8_t dirtyCount = 0;
+static const Rect *dirtyArea;
+static void (*dirtyRedraw)(const Rect *pArea);
+
+/* Rectangles (spans are one row high) of the batch being drawn */
+static Rect batchItems[MAX_BATCH_ITEMS];
+
+/* Edge table sorted by YMin and the active edge list of LCD_FillPolygon */
+static PolyEdgeTypeDef polyEdges[MAX_POLY_POINTS];
+static uint8_t polyActive[MAX_POLY_POINTS];
 
 uint16_t RGB565(uint8_t r, uint8_t g, uint8_t b)
 {
     return (((((uint16_t)r) & 0x1F) << 11) | ((((uint16_t)g) & 0x3f) << 5) | (((uint16_t)b) & 0x1F));
 }
 
+/**
+ * @brief  Sets the clip rectangle to the top of the clip stack within the screen.
+ */
+static void UpdateClip(void)
+{
+	int32_t x1 = 0, y1 = 0, x2 = LCD_GetWidth(), y2 = LCD_GetHeight();
+
+	if(clipDepth > 0)
+	{
+		Rect *pClip = &clipStack[clipDepth - 1];
+
+		if(pClip->X > x1) x1 = pClip->X;
+		if(pClip->Y > y1) y1 = pClip->Y;
+		if(pClip->X + pClip->Width < x2) x2 = pClip->X + pClip->Width;
+		if(pClip->Y + pClip->Height < y2) y2 = pClip->Y + pClip->Height;
+	}
+
+	DrawProp.Clip.X = x1;
+	DrawProp.Clip.Y = y1;
+	DrawProp.Clip.Width = x2 > x1 ? x2 - x1 : 0;
+	DrawProp.Clip.Height = y2 > y1 ? y2 - y1 : 0;
+}
+
 /**
  * @brief  Initializes the LCD.
  * @retval LCD state
@@ -108,6 +336,11 @@ uint8_t LCD_Init(void)
 
 		/* LCD Init */
 		lcd_drv->Init();
+		lcdRotation = 0;
+
+		/* Nothing clipped but the screen */
+		clipDepth = 0;
+		UpdateClip();
 
 		ret = LCD_OK;
 	}
@@ -126,7 +359,18 @@ uint8_t LCD_Init(void)
  */
 void LCD_Clear(uint16_t Color)
 {
-	lcd_drv->Clear(Color);
+	uint16_t colorbackup = DrawProp.TextColor;
+
+	if(clipDepth == 0)
+	{
+		lcd_drv->Clear(Color);
+		return;
+	}
+
+	/* Only the clip rectangle is cleared */
+	DrawProp.TextColor = Color;
+	LCD_FillRect(DrawProp.Clip.X, DrawProp.Clip.Y, DrawProp.Clip.Width, DrawProp.Clip.Height);
+	DrawProp.TextColor = colorbackup;
 }
 
 /**
@@ -144,7 +388,11 @@ void LCD_Clear(uint16_t Color)
  */
 void LCD_SetRotation(uint8_t rotation)
 {
+	lcdRotation = rotation % 4;
 	lcd_drv->SetRotation(rotation);
+
+	/* The screen size may have changed */
+	UpdateClip();
 }
 
 /**
@@ -229,6 +477,30 @@ void LCD_SetBackColor(uint16_t Color)
 	DrawProp.BackColor = Color;
 }
 
+/**
+ * @brief  Selects whether the glyph background is painted.
+ * @param  Mode: Text mode
+ *          This parameter can be one of the following values:
+ *            @arg  OPAQUE_TEXT: background pixels are painted with the back color
+ *            @arg  TRANSPARENT_TEXT: background pixels are left untouched
+ */
+void LCD_SetTextMode(Text_ModeTypdef Mode)
+{
+	textMode = Mode;
+}
+
+/**
+ * @brief  Magnifies text by replicating each font pixel into a square of pixels.
+ * @param  Scale: 1 for the font size, up to MAX_TEXT_SCALE
+ */
+void LCD_SetTextScale(uint8_t Scale)
+{
+	if(Scale < 1) Scale = 1;
+	if(Scale > MAX_TEXT_SCALE) Scale = MAX_TEXT_SCALE;
+
+	textScale = Scale;
+}
+
 /**
  * @brief  Sets the LCD text font.
  * @param  pFonts: Font to be used
@@ -248,541 +520,4329 @@ sFONT *LCD_GetFont(void)
 }
 
 /**
- * @brief  Displays one character.
- * @param  Xpos: Line where to display the character shape
- * @param  Ypos: Start column address
- * @param  Ascii: Character ascii code
- *           This parameter must be a number between Min_Data = 0x20 and Max_Data = 0x7E
+ * @brief  Restricts drawing to a rectangle inside the current clip rectangle.
+ * @param  Xpos: X position
+ * @param  Ypos: Y position
+ * @param  Width: Clip rectangle width
+ * @param  Height: Clip rectangle height
+ * @retval LCD_OK or LCD_ERROR if MAX_CLIP_DEPTH rectangles are already pushed
  */
-void LCD_DisplayChar(uint16_t Xpos, uint16_t Ypos, uint8_t Ascii)
+uint8_t LCD_PushClip(int16_t Xpos, int16_t Ypos, uint16_t Width, uint16_t Height)
 {
-	const uint8_t *pChar = &DrawProp.pFont->table[(Ascii-' ') * DrawProp.pFont->Height * ((DrawProp.pFont->Width + 7) / 8)];
+	int32_t x1 = Xpos, y1 = Ypos, x2 = Xpos + Width, y2 = Ypos + Height;
 
-	uint32_t counterh = 0, counterw = 0, index = 0;
-	uint16_t height = 0, width = 0;
-	uint8_t offset = 0;
-	uint8_t *pchar = NULL;
-	uint32_t line = 0;
+	if(clipDepth >= MAX_CLIP_DEPTH)
+	{
+		return LCD_ERROR;
+	}
+
+	if(clipDepth > 0)
+	{
+		Rect *pClip = &clipStack[clipDepth - 1];
+
+		if(pClip->X > x1) x1 = pClip->X;
+		if(pClip->Y > y1) y1 = pClip->Y;
+		if(pClip->X + pClip->Width < x2) x2 = pClip->X + pClip->Width;
+		if(pClip->Y + pClip->Height < y2) y2 = pClip->Y + pClip->Height;
+	}
 
-	height = DrawProp.pFont->Height;
-	width  = DrawProp.pFont->Width;
+	clipStack[clipDepth].X = x1;
+	clipStack[clipDepth].Y = y1;
+	clipStack[clipDepth].Width = x2 > x1 ? x2 - x1 : 0;
+	clipStack[clipDepth].Height = y2 > y1 ? y2 - y1 : 0;
+	clipDepth++;
 
-	/* Fill bitmap header*/
-	*(uint16_t *) (bitmap + 2) = (uint16_t)(height*width*2+OFFSET_BITMAP);
-	*(uint16_t *) (bitmap + 4) = (uint16_t)((height*width*2+OFFSET_BITMAP)>>16);
-	*(uint16_t *) (bitmap + 10) = OFFSET_BITMAP;
-	*(uint16_t *) (bitmap + 18) = (uint16_t)(width);
-	*(uint16_t *) (bitmap + 20) = (uint16_t)((width)>>16);
-	*(uint16_t *) (bitmap + 22) = (uint16_t)(height);
-	*(uint16_t *) (bitmap + 24) = (uint16_t)((height)>>16);
+	UpdateClip();
 
-	offset =  8 *((width + 7)/8) -  width ;
+	return LCD_OK;
+}
 
-	for(counterh = 0; counterh < height; counterh++)
+/**
+ * @brief  Restores the clip rectangle active before the last LCD_PushClip().
+ */
+void LCD_PopClip(void)
+{
+	if(clipDepth > 0)
 	{
-		pchar = ((uint8_t *)pChar + (width + 7)/8 * counterh);
+		clipDepth--;
+	}
 
-		if(((width + 7)/8) == 3)
-		{
-			line =  (pchar[0]<< 16) | (pchar[1]<< 8) | pchar[2];
-		}
+	UpdateClip();
+}
 
-		if(((width + 7)/8) == 2)
-		{
-			line =  (pchar[0]<< 8) | pchar[1];
-		}
+/**
+ * @brief  Blends two RGB(5-6-5) colors.
+ * @param  Fore: Foreground color
+ * @param  Back: Background color
+ * @param  Alpha: Foreground weight 0..32
+ * @retval Blended color
+ */
+static uint16_t BlendRGB565(uint16_t Fore, uint16_t Back, uint32_t Alpha)
+{
+	/* Spread G apart from R and B so all channels are scaled by one multiply */
+	uint32_t f = (Fore | ((uint32_t)Fore << 16)) & 0x07E0F81F;
+	uint32_t b = (Back | ((uint32_t)Back << 16)) & 0x07E0F81F;
+	uint32_t c = ((f * Alpha + b * (32 - Alpha)) >> 5) & 0x07E0F81F;
+
+	return (uint16_t)(c | (c >> 16));
+}
+
+/* Foreground weight 0..32 of an anti-aliasing level */
+#define AA_ALPHA(L)             (((L) * 32 + (AA_LEVELS - 1) / 2) / (AA_LEVELS - 1))
 
-		if(((width + 7)/8) == 1)
+/**
+ * @brief  Gets the blend ramp of the current text and background colors.
+ * @retval Ramp from BackColor (level 0) to TextColor (level AA_LEVELS-1)
+ */
+static const uint16_t *GetAARamp(void)
+{
+	uint8_t i = 0;
+	AARampTypeDef *pRamp = NULL;
+
+	for(i = 0; i < aaRampCount; i++)
+	{
+		if(aaRamps[i].TextColor == DrawProp.TextColor && aaRamps[i].BackColor == DrawProp.BackColor)
 		{
-			line =  pchar[0];
+			return aaRamps[i].Color;
 		}
+	}
+
+	/* Replace the oldest ramp */
+	pRamp = &aaRamps[aaRampNext];
+	aaRampNext = (aaRampNext + 1) % AA_RAMPS;
+	if(aaRampCount < AA_RAMPS)
+	{
+		aaRampCount++;
+	}
+
+	pRamp->TextColor = DrawProp.TextColor;
+	pRamp->BackColor = DrawProp.BackColor;
+	for(i = 0; i < AA_LEVELS; i++)
+	{
+		pRamp->Color[i] = BlendRGB565(DrawProp.TextColor, DrawProp.BackColor, AA_ALPHA(i));
+	}
+
+	return pRamp->Color;
+}
+
+/**
+ * @brief  Draws a pixel of an anti-aliased shape.
+ * @param  Xpos: X position
+ * @param  Ypos: Y position
+ * @param  Level: Intensity 0..AA_LEVELS-1
+ * @param  pRamp: Blend ramp, used when not reading back
+ */
+static void DrawAAPixel(int16_t Xpos, int16_t Ypos, uint8_t Level, const uint16_t *pRamp)
+{
+	uint16_t color = 0;
+
+	if(CLIP_OUT(Xpos, Ypos, 1, 1))
+	{
+		return;
+	}
 
-		for (counterw = 0; counterw < width; counterw++)
+	if(aaMode == AA_READBACK_MODE)
+	{
+		if(Level == 0)
 		{
-			/* Image in the bitmap is written from the bottom to the top */
-			/* Need to invert image in the bitmap */
-			index = ((counterh*width)+(counterw))*2+OFFSET_BITMAP;
-			if(line & (1 << (width- counterw + offset- 1)))
-			{
-				bitmap[index] = (uint8_t)DrawProp.TextColor;
-				bitmap[index+1] = (uint8_t)(DrawProp.TextColor >> 8);
-			}
-			else
-			{
-				bitmap[index] = (uint8_t)DrawProp.BackColor;
-				bitmap[index+1] = (uint8_t)(DrawProp.BackColor >> 8);
-			}
+			return;
 		}
+		lcd_drv->ReadRGBImage(Xpos, Ypos, &color, 1);
+		color = BlendRGB565(DrawProp.TextColor, color, AA_ALPHA(Level));
+	}
+	else
+	{
+		color = pRamp[Level];
 	}
 
-	LCD_DrawBitmap(Xpos, Ypos, bitmap);
+	lcd_drv->WritePixel(Xpos, Ypos, color);
 }
 
 /**
- * @brief  Displays characters on the LCD.
- * @param  Xpos: X position (in pixel)
- * @param  Ypos: Y position (in pixel)
- * @param  pText: Pointer to string to display on LCD
- * @param  Mode: Display mode
- *          This parameter can be one of the following values:
- *            @arg  CENTER_MODE
- *            @arg  RIGHT_MODE
- *            @arg  LEFT_MODE
+ * @brief  Reads bits MSB first from a font table.
+ * @param  pData: Pointer to the bits
+ * @param  Bit: Position of the first bit
+ * @param  Count: Number of bits, at most 25
+ * @retval Bits, the first one is bit (Count - 1)
  */
-void LCD_DisplayStringAt(uint16_t Xpos, uint16_t Ypos, uint8_t *pText, Line_ModeTypdef Mode)
+static uint32_t GlyphBits(const uint8_t *pData, uint32_t Bit, uint16_t Count)
 {
-	uint16_t refcolumn = 1, counter = 0;
-	uint32_t size = 0, xsize = 0;
-	uint8_t  *ptr = pText;
-
-	/* Get the text size */
-	while (*ptr++) size ++ ;
+	uint16_t bytes = ((Bit & 7) + Count + 7) / 8, i = 0;
+	uint32_t bits = 0;
 
-	/* Characters number per line */
-	xsize = (LCD_GetWidth()/DrawProp.pFont->Width);
+	pData += Bit / 8;
 
-	switch (Mode)
+	for(i = 0; i < bytes; i++)
 	{
-	case CENTER_MODE:
+		bits = (bits << 8) | pData[i];
+	}
+
+	return (bits >> (8 * bytes - (Bit & 7) - Count)) & ((1UL << Count) - 1);
+}
+
+/**
+ * @brief  Decodes the next character of a UTF-8 string.
+ * @param  ppText: Pointer to the string position, moved past the character
+ * @param  pEnd: End of the string
+ * @retval Character code, 0 at the end of the string
+ */
+static uint16_t NextChar(const uint8_t **ppText, const uint8_t *pEnd)
+{
+	const uint8_t *ptr = *ppText;
+	uint32_t code = 0;
+	uint8_t extra = 0;
+
+	if(ptr >= pEnd)
 	{
-		refcolumn = Xpos + ((xsize - size)* DrawProp.pFont->Width) / 2;
-		break;
+		return 0;
 	}
-	case LEFT_MODE:
+
+	code = *ptr++;
+
+	if(code >= 0xF0 && code < 0xF8)
 	{
-		refcolumn = Xpos;
-		break;
+		extra = 3;
+		code &= 0x07;
 	}
-	case RIGHT_MODE:
+	else if(code >= 0xE0 && code < 0xF0)
 	{
-		refcolumn =  - Xpos + ((xsize - size)*DrawProp.pFont->Width);
-		break;
+		extra = 2;
+		code &= 0x0F;
 	}
-	default:
+	else if(code >= 0xC0 && code < 0xE0)
 	{
-		refcolumn = Xpos;
-		break;
+		extra = 1;
+		code &= 0x1F;
 	}
+	else if(code >= 0x80)
+	{
+		/* Stray continuation or invalid byte */
+		code = REPLACEMENT_CHAR;
 	}
 
-	/* Send the string character by character on lCD */
-	while ((*pText != 0) & (((LCD_GetWidth() - (counter*DrawProp.pFont->Width)) & 0xFFFF) >= DrawProp.pFont->Width))
+	while(extra > 0 && ptr < pEnd && (*ptr & 0xC0) == 0x80)
 	{
-		/* Display one character on LCD */
-		LCD_DisplayChar(refcolumn, Ypos, *pText);
-		/* Decrement the column position by 16 */
-		refcolumn += DrawProp.pFont->Width;
-		/* Point on the next character */
-		pText++;
-		counter++;
+		code = (code << 6) | (*ptr++ & 0x3F);
+		extra--;
 	}
+
+	*ppText = ptr;
+
+	/* Truncated sequences and characters the fonts cannot index */
+	return extra > 0 || code > 0xFFFF ? REPLACEMENT_CHAR : code;
 }
 
 /**
- * @brief  Displays a character on the LCD.
- * @param  Line: Line where to display the character shape
- *          This parameter can be one of the following values:
- *            @arg  0..9: if the Current fonts is Font16x24
- *            @arg  0..19: if the Current fonts is Font12x12 or Font8x12
- *            @arg  0..29: if the Current fonts is Font8x8
- * @param  pText: Pointer to string to display on LCD
+ * @brief  Finds the glyph index of a character in the current font.
+ * @param  Code: Character code
+ * @retval Glyph index, the fallback glyph if the font lacks the character
  */
-void LCD_DisplayStringAtLine(uint16_t Line, uint8_t *pText)
+static uint16_t GlyphIndex(uint16_t Code)
 {
-	LCD_DisplayStringAt(0, LINE(Line),pText, LEFT_MODE);
-}
+	const sRANGE *pRanges = DrawProp.pFont->ranges;
+	int32_t lo = 0, hi = (int32_t)DrawProp.pFont->rangeCount - 1, mid = 0;
 
+	if(pRanges == NULL)
+	{
+		return Code >= 0x20 && Code <= 0x7E ? Code - 0x20 : DrawProp.pFont->fallback;
+	}
 
-void LCD_ClearStringLine(uint16_t Line)
-{
-	uint16_t colorbackup = DrawProp.TextColor;
-	DrawProp.TextColor = DrawProp.BackColor;;
+	/* Blocks are sorted and do not overlap */
+	while(lo <= hi)
+	{
+		mid = (lo + hi) / 2;
 
-	/* Draw a rectangle with background color */
-	LCD_FillRect(0, (Line * DrawProp.pFont->Height), LCD_GetWidth(), DrawProp.pFont->Height);
+		if(Code < pRanges[mid].First)
+		{
+			hi = mid - 1;
+		}
+		else if(Code > pRanges[mid].Last)
+		{
+			lo = mid + 1;
+		}
+		else
+		{
+			return pRanges[mid].Glyph + (Code - pRanges[mid].First);
+		}
+	}
 
-	DrawProp.TextColor = colorbackup;
+	return DrawProp.pFont->fallback;
 }
 
 /**
- * @brief  Reads an LCD pixel.
- * @param  Xpos: X position
- * @param  Ypos: Y position
- * @retval RGB pixel color
+ * @brief  Looks up a glyph of the current font.
+ * @param  Code: Character code
+ * @param  pGlyph: Receives the glyph box, its bits and advance
  */
-uint16_t LCD_ReadPixel(uint16_t Xpos, uint16_t Ypos)
+static void GetGlyph(uint16_t Code, GlyphTypeDef *pGlyph)
 {
-	return lcd_drv->ReadPixel(Xpos, Ypos);
+	sFONT *pFont = DrawProp.pFont;
+	uint16_t index = GlyphIndex(Code);
+
+	pGlyph->Index = index;
+	pGlyph->Advance = pFont->advances != NULL ? pFont->advances[index] : pFont->Width;
+	pGlyph->Bpp = 1;
+	pGlyph->Scale = AA_LEVELS - 1;
+
+	if(pFont->glyphs == NULL)
+	{
+		/* Whole cells, rows padded to bytes */
+		pGlyph->Stride = 8 * ((pFont->Width + 7) / 8);
+		pGlyph->pBits = &pFont->table[index * pFont->Height * (pGlyph->Stride / 8)];
+		pGlyph->Width = pFont->Width;
+		pGlyph->Height = pFont->Height;
+		pGlyph->Left = 0;
+		pGlyph->Top = 0;
+		return;
+	}
+
+	/* Packed box of the set pixels, rows unpadded */
+	if(pFont->bpp > 1)
+	{
+		pGlyph->Bpp = pFont->bpp;
+		pGlyph->Scale = (AA_LEVELS - 1) / ((1 << pFont->bpp) - 1);
+	}
+	pGlyph->pBits = &pFont->table[pFont->glyphs[index].Offset];
+	pGlyph->Stride = pFont->glyphs[index].Width * pGlyph->Bpp;
+	pGlyph->Width = pFont->glyphs[index].Width;
+	pGlyph->Height = pFont->glyphs[index].Height;
+	pGlyph->Left = pFont->glyphs[index].Left;
+	pGlyph->Top = pFont->glyphs[index].Top;
 }
 
 /**
- * @brief  Draws a pixel on LCD.
- * @param  Xpos: X position
- * @param  Ypos: Y position
- * @param  RGBCode: Pixel color in RGB mode (5-6-5)
+ * @brief  Reads one row of a glyph box.
+ * @param  pGlyph: Glyph
+ * @param  Row: Row counted from the top of the text line
+ * @retval Row bits, bit (Width - 1) is the leftmost pixel of the box. Anti-aliased
+ *         glyphs are read pixel by pixel, for them it is only nonzero inside the box.
  */
-void LCD_DrawPixel(uint16_t Xpos, uint16_t Ypos, uint16_t RGBCode)
+static uint32_t GlyphLine(const GlyphTypeDef *pGlyph, int32_t Row)
 {
-	lcd_drv->WritePixel(Xpos, Ypos, RGBCode);
+	if(Row < pGlyph->Top || Row >= pGlyph->Top + pGlyph->Height)
+	{
+		return 0;
+	}
+
+	if(pGlyph->Bpp > 1)
+	{
+		return 1;
+	}
+
+	return GlyphBits(pGlyph->pBits, (Row - pGlyph->Top) * pGlyph->Stride, pGlyph->Width);
 }
 
 /**
- * @brief  Draws an uni-line (between two points).
- * @param  x1: Point 1 X position
- * @param  y1: Point 1 Y position
- * @param  x2: Point 2 X position
- * @param  y2: Point 2 Y position
+ * @brief  Reads one pixel of a glyph row.
+ * @param  pGlyph: Glyph
+ * @param  Line: Row bits returned by GlyphLine
+ * @param  Row: Row counted from the top of the text line
+ * @param  Offset: Pixel position from the glyph pen position
+ * @retval Intensity 0..AA_LEVELS-1
  */
-void LCD_DrawLine(int16_t x1, int16_t y1, int16_t x2, int16_t y2)
+static uint8_t GlyphPixel(const GlyphTypeDef *pGlyph, uint32_t Line, int32_t Row, int32_t Offset)
 {
-	int16_t deltax = 0, deltay = 0, x = 0, y = 0, xinc1 = 0, xinc2 = 0,
-			yinc1 = 0, yinc2 = 0, den = 0, num = 0, numadd = 0, numpixels = 0,
-			curpixel = 0;
-
-	deltax = ABS(x2 - x1);        /* The difference between the x's */
-	deltay = ABS(y2 - y1);        /* The difference between the y's */
-	x = x1;                       /* Start x off at the first pixel */
-	y = y1;                       /* Start y off at the first pixel */
+	int32_t column = 0;
 
-	if (x2 >= x1)                 /* The x-values are increasing */
-	{
-		xinc1 = 1;
-		xinc2 = 1;
-	}
-	else                          /* The x-values are decreasing */
+	if(Line == 0)
 	{
-		xinc1 = -1;
-		xinc2 = -1;
+		return 0;
 	}
 
-	if (y2 >= y1)                 /* The y-values are increasing */
+	column = Offset - pGlyph->Left;
+	if(column < 0 || column >= pGlyph->Width)
 	{
-		yinc1 = 1;
-		yinc2 = 1;
+		return 0;
 	}
-	else                          /* The y-values are decreasing */
+
+	if(pGlyph->Bpp == 1)
 	{
-		yinc1 = -1;
-		yinc2 = -1;
+		return (Line & (1UL << (pGlyph->Width - 1 - column))) ? AA_LEVELS - 1 : 0;
 	}
 
-	if (deltax >= deltay)         /* There is at least one x-value for every y-value */
+	return GlyphBits(pGlyph->pBits, (Row - pGlyph->Top) * pGlyph->Stride + column * pGlyph->Bpp, pGlyph->Bpp) * pGlyph->Scale;
+}
+
+/**
+ * @brief  Gets the kerning of a character pair of the current font.
+ * @param  First: Left character
+ * @param  Second: Right character
+ * @retval Advance adjustment in pixels
+ */
+static int32_t GetKerning(uint16_t First, uint16_t Second)
+{
+	const sKERNPAIR *pPairs = DrawProp.pFont->kerning;
+	uint32_t key = ((uint32_t)First << 16) | Second, pair = 0;
+	int32_t lo = 0, hi = (int32_t)DrawProp.pFont->kerningCount - 1, mid = 0;
+
+	/* Pairs are sorted by first, then second character */
+	while(lo <= hi)
 	{
-		xinc1 = 0;                  /* Don't change the x when numerator >= denominator */
-		yinc2 = 0;                  /* Don't change the y for every iteration */
-		den = deltax;
-		num = deltax / 2;
-		numadd = deltay;
-		numpixels = deltax;         /* There are more x-values than y-values */
+		mid = (lo + hi) / 2;
+		pair = ((uint32_t)pPairs[mid].First << 16) | pPairs[mid].Second;
+
+		if(pair == key)
+		{
+			return pPairs[mid].Offset;
+		}
+
+		if(pair < key)
+		{
+			lo = mid + 1;
+		}
+		else
+		{
+			hi = mid - 1;
+		}
 	}
-	else                          /* There is at least one y-value for every x-value */
+
+	return 0;
+}
+
+/**
+ * @brief  Gets the width of the cell of a character followed by another one.
+ * @param  pGlyph: Glyph of the character
+ * @param  Code: Character code
+ * @param  Next: Next character code, 0 if none
+ * @retval Cell width in pixels, text scale applied
+ */
+static int32_t CellWidth(const GlyphTypeDef *pGlyph, uint16_t Code, uint16_t Next)
+{
+	int32_t width = pGlyph->Advance;
+
+	if(Next != 0 && DrawProp.pFont->kerningCount > 0)
 	{
-		xinc2 = 0;                  /* Don't change the x for every iteration */
-		yinc1 = 0;                  /* Don't change the y when numerator >= denominator */
-		den = deltay;
-		num = deltay / 2;
-		numadd = deltax;
-		numpixels = deltay;         /* There are more y-values than x-values */
+		width += GetKerning(Code, Next);
 	}
 
-	for (curpixel = 0; curpixel <= numpixels; curpixel++)
+	return width > 0 ? width * textScale : 0;
+}
+
+/**
+ * @brief  Measures characters of the current font.
+ * @param  pText: Pointer to the UTF-8 characters
+ * @param  Size: Size of the characters in bytes
+ * @retval Width in pixels, text scale applied
+ */
+static int32_t MeasureText(const uint8_t *pText, uint16_t Size)
+{
+	GlyphTypeDef glyph;
+	const uint8_t *pEnd = pText + Size;
+	uint16_t code = NextChar(&pText, pEnd), next = 0;
+	int32_t width = 0;
+
+	for(; code != 0; code = next)
 	{
-		if (x >= 0 && y >= 0)
+		next = NextChar(&pText, pEnd);
+		GetGlyph(code, &glyph);
+		width += CellWidth(&glyph, code, next);
+	}
+
+	return width;
+}
+
+/**
+ * @brief  Measures a string in the current font without drawing it.
+ * @param  pText: Pointer to UTF-8 string
+ * @retval Width in pixels, the height is the font height, both times the text scale
+ */
+uint16_t LCD_MeasureString(uint8_t *pText)
+{
+	uint16_t size = 0;
+
+	while(pText[size] != 0) size++;
+
+	return MeasureText(pText, size);
+}
+
+#if GLYPH_CACHE_ENTRIES > 0
+/**
+ * @brief  Looks up the cell of a glyph in the current font and colors in the glyph cache.
+ * @param  pGlyph: Glyph
+ * @param  pRamp: Blend ramp of anti-aliased fonts, NULL for 1 bpp ones
+ * @param  Fill: 1 to count the lookup and to cache the cell if it is missing
+ * @retval Cell pixels row by row, Advance wide, or NULL if the cell is not cached
+ */
+static const uint16_t *GetCachedCell(const GlyphTypeDef *pGlyph, const uint16_t *pRamp, uint8_t Fill)
+{
+	GlyphCacheTypeDef *pEntry = NULL, *pOldest = &glyphCache[0];
+	uint16_t *pPixel = NULL;
+	uint16_t height = DrawProp.pFont->Height, i = 0, row = 0, column = 0;
+	uint32_t line = 0;
+	uint8_t level = 0;
+
+	/* Only glyphs that stay inside their cell */
+	if(pGlyph->Left < 0 || pGlyph->Left + pGlyph->Width > pGlyph->Advance ||
+	   pGlyph->Top + pGlyph->Height > height || pGlyph->Advance * height > GLYPH_CACHE_PIXELS)
+	{
+		return NULL;
+	}
+
+	for(i = 0; i < GLYPH_CACHE_ENTRIES; i++)
+	{
+		pEntry = &glyphCache[i];
+
+		if(pEntry->pFont == DrawProp.pFont && pEntry->Index == pGlyph->Index &&
+		   pEntry->TextColor == DrawProp.TextColor && pEntry->BackColor == DrawProp.BackColor)
 		{
-			LCD_DrawPixel(x, y, DrawProp.TextColor);  /* Draw the current pixel */
+			if(Fill)
+			{
+				glyphCacheHits++;
+				pEntry->Used = ++glyphCacheClock;
+			}
+			return pEntry->Pixels;
 		}
-		num += numadd;                            /* Increase the numerator by the top of the fraction */
-		if (num >= den)                           /* Check if numerator >= denominator */
+
+		if(pEntry->Used < pOldest->Used)
 		{
-			num -= den;                             /* Calculate the new numerator value */
-			x += xinc1;                             /* Change the x as appropriate */
-			y += yinc1;                             /* Change the y as appropriate */
+			pOldest = pEntry;
+		}
+	}
+
+	if(!Fill)
+	{
+		return NULL;
+	}
+
+	/* Free entries were never used and go first */
+	glyphCacheMisses++;
+	pEntry = pOldest;
+	pEntry->pFont = DrawProp.pFont;
+	pEntry->Index = pGlyph->Index;
+	pEntry->TextColor = DrawProp.TextColor;
+	pEntry->BackColor = DrawProp.BackColor;
+	pEntry->Used = ++glyphCacheClock;
+
+	for(row = 0, pPixel = pEntry->Pixels; row < height; row++)
+	{
+		line = GlyphLine(pGlyph, row);
+
+		for(column = 0; column < pGlyph->Advance; column++)
+		{
+			level = GlyphPixel(pGlyph, line, row, column);
+
+			if(pRamp != NULL)
+			{
+				*pPixel++ = pRamp[level];
+			}
+			else
+			{
+				*pPixel++ = level ? DrawProp.TextColor : DrawProp.BackColor;
+			}
 		}
-		x += xinc2;                               /* Change the x as appropriate */
-		y += yinc2;                               /* Change the y as appropriate */
 	}
+
+	return pEntry->Pixels;
 }
+#endif
 
 /**
- * @brief  Draws an horizontal line.
- * @param  Xpos: X position
+ * @brief  Gets the glyph cache counters. Opaque glyphs are counted once per
+ *         string drawn, glyphs overlapping their neighbours are not cached.
+ * @param  pHits: Receives the number of glyphs drawn from the cache
+ * @param  pMisses: Receives the number of glyphs expanded into the cache
+ */
+void LCD_GetGlyphCacheStats(uint32_t *pHits, uint32_t *pMisses)
+{
+#if GLYPH_CACHE_ENTRIES > 0
+	*pHits = glyphCacheHits;
+	*pMisses = glyphCacheMisses;
+#else
+	*pHits = 0;
+	*pMisses = 0;
+#endif
+}
+
+/**
+ * @brief  Empties the glyph cache and clears its counters.
+ */
+void LCD_ClearGlyphCache(void)
+{
+#if GLYPH_CACHE_ENTRIES > 0
+	uint16_t i = 0;
+
+	for(i = 0; i < GLYPH_CACHE_ENTRIES; i++)
+	{
+		glyphCache[i].pFont = NULL;
+		glyphCache[i].Used = 0;
+	}
+
+	glyphCacheClock = 0;
+	glyphCacheHits = 0;
+	glyphCacheMisses = 0;
+#endif
+}
+
+/**
+ * @brief  Writes a run of transparent text pixels, short runs are queued pixel by pixel.
+ * @param  Xpos: X position of the run
+ * @param  Ypos: Y position of the run
+ * @param  Length: Run length
+ * @param  pQueue: X positions of the queued pixels of the row
+ * @param  Count: Number of queued pixels
+ * @retval Number of queued pixels
+ */
+static uint16_t EmitTextRun(int32_t Xpos, int32_t Ypos, int32_t Length, uint16_t *pQueue, uint16_t Count)
+{
+	if(Length >= TEXT_RUN_MIN)
+	{
+		lcd_drv->DrawHLine(Xpos, Ypos, Length, DrawProp.TextColor);
+		return Count;
+	}
+
+	while(Length-- > 0)
+	{
+		if(Count == GLYPH_BUFFER_SIZE)
+		{
+			lcd_drv->WriteRowPixels(Ypos, pQueue, Count, DrawProp.TextColor);
+			Count = 0;
+		}
+
+		pQueue[Count++] = Xpos++;
+	}
+
+	return Count;
+}
+
+/**
+ * @brief  Draws a run of characters of the current font, opaque text inside one window.
+ * @param  Xpos: X position of the first character, may be off the screen
  * @param  Ypos: Y position
- * @param  Length: Line length
+ * @param  pText: Pointer to the UTF-8 characters
+ * @param  Size: Size of the characters in bytes
  */
-void LCD_DrawHLine(int16_t Xpos, int16_t Ypos, uint16_t Length)
+static void DrawText(int32_t Xpos, int32_t Ypos, const uint8_t *pText, uint16_t Size)
+{
+	GlyphTypeDef prev, glyph, next;
+	const uint8_t *ptr = NULL, *pEnd = pText + Size;
+	const uint16_t *pRamp = NULL;
+	uint16_t pixels[GLYPH_BUFFER_SIZE];
+	uint16_t count = 0, code = 0, nextCode = 0, color = 0, fillColor = 0;
+	uint32_t prevLine = 0, line = 0, nextLine = 0, fillLength = 0;
+	int32_t x1 = Xpos, y1 = Ypos, x2 = Xpos + MeasureText(pText, Size), y2 = Ypos + DrawProp.pFont->Height * textScale;
+	int32_t x = 0, y = 0, xend = 0, end = 0, pen = 0, prevPen = 0, row = 0, column = 0, span = 0;
+	uint8_t level = 0, other = 0;
+	int32_t runStart = 0, runLength = 0;
+#if GLYPH_CACHE_ENTRIES > 0
+	const uint16_t *pCell = NULL;
+	int32_t prevRight = 0;
+#endif
+
+	if(x1 < CLIP_LEFT) x1 = CLIP_LEFT;
+	if(y1 < CLIP_TOP) y1 = CLIP_TOP;
+	if(x2 > CLIP_RIGHT) x2 = CLIP_RIGHT;
+	if(y2 > CLIP_BOTTOM) y2 = CLIP_BOTTOM;
+
+	if(x2 <= x1 || y2 <= y1)
+	{
+		return;
+	}
+
+	/* Anti-aliased fonts take their colors from the blend ramp of the current
+	 * colors, it is only computed again when they change */
+	if(DrawProp.pFont->bpp > 1 && (textMode == OPAQUE_TEXT || aaMode != AA_READBACK_MODE))
+	{
+		pRamp = GetAARamp();
+	}
+
+	/* Each window row crosses all the glyphs, their rows are expanded straight
+	 * from the font table and streamed whenever the buffer is full */
+	if(textMode == OPAQUE_TEXT)
+	{
+		LCD_SetDisplayWindow(x1, y1, x2 - x1, y2 - y1);
+		lcd_drv->SetCursor(x1, y1);
+	}
+
+	for(y = y1; y < y2; y++)
+	{
+		/* Glyph cells tile the row from Xpos on. A cell also shows the pixels of
+		 * its neighbours' boxes that overhang its edges, like negative bearings
+		 * or kerned pairs. Scaled text reads each font row textScale times */
+		row = (y - Ypos) / textScale;
+		prevLine = 0;
+#if GLYPH_CACHE_ENTRIES > 0
+		prevRight = Xpos;
+#endif
+		ptr = pText;
+		code = NextChar(&ptr, pEnd);
+		GetGlyph(code, &glyph);
+		line = GlyphLine(&glyph, row);
+
+		for(pen = Xpos, x = x1; code != 0 && x < x2; code = nextCode)
+		{
+			nextLine = 0;
+			nextCode = NextChar(&ptr, pEnd);
+			if(nextCode != 0)
+			{
+				GetGlyph(nextCode, &next);
+				nextLine = GlyphLine(&next, row);
+			}
+
+			xend = pen + CellWidth(&glyph, code, nextCode);
+			end = xend < x2 ? xend : x2;
+
+			if(end > x && line == 0 && prevLine == 0 && nextLine == 0 && textMode != OPAQUE_TEXT)
+			{
+				/* Nothing to write in this glyph row */
+				if(runLength > 0)
+				{
+					count = EmitTextRun(runStart, y, runLength, pixels, count);
+					runLength = 0;
+				}
+				x = end;
+			}
+
+#if GLYPH_CACHE_ENTRIES > 0
+			/* Cells no neighbour reaches into are copied from the glyph cache,
+			 * they are looked up and filled on the first row */
+			pCell = NULL;
+			if(textMode == OPAQUE_TEXT && textScale == 1 && end > x && prevRight <= pen && (nextCode == 0 || next.Left >= 0))
+			{
+				pCell = GetCachedCell(&glyph, pRamp, y == y1);
+			}
+
+			if(pCell != NULL)
+			{
+				for(pCell += (y - Ypos) * glyph.Advance; x < end; x++)
+				{
+					if(count == GLYPH_BUFFER_SIZE)
+					{
+						lcd_drv->WriteGRAM(pixels, count);
+						count = 0;
+					}
+
+					pixels[count++] = x - pen < glyph.Advance ? pCell[x - pen] : DrawProp.BackColor;
+				}
+			}
+#endif
+
+			for(; x < end; x += span)
+			{
+				/* Cells are textScale times their font width, so one font column
+				 * covers the same span of pixels in the glyph and its neighbours */
+				column = (x - pen) / textScale;
+				span = pen + (column + 1) * textScale - x;
+				if(span > end - x) span = end - x;
+
+				/* Overlapping pixels keep the strongest intensity */
+				level = GlyphPixel(&glyph, line, row, column);
+				other = GlyphPixel(&prev, prevLine, row, column + (pen - prevPen) / textScale);
+				level = other > level ? other : level;
+				other = GlyphPixel(&next, nextLine, row, column - (xend - pen) / textScale);
+				level = other > level ? other : level;
+
+				if(textMode == OPAQUE_TEXT)
+				{
+					color = pRamp != NULL ? pRamp[level] : (level ? DrawProp.TextColor : DrawProp.BackColor);
+
+					if(textScale == 1)
+					{
+						if(count == GLYPH_BUFFER_SIZE)
+						{
+							lcd_drv->WriteGRAM(pixels, count);
+							count = 0;
+						}
+						pixels[count++] = color;
+						continue;
+					}
+
+					/* Replicated pixels are written as fill runs, across glyphs and rows too */
+					if(fillLength > 0 && color != fillColor)
+					{
+						lcd_drv->FillGRAM(fillColor, fillLength);
+						fillLength = 0;
+					}
+					fillColor = color;
+					fillLength += span;
+				}
+				else if(level == AA_LEVELS - 1)
+				{
+					/* Foreground pixels are merged into runs, across glyphs too */
+					if(runLength == 0)
+					{
+						runStart = x;
+					}
+					runLength += span;
+				}
+				else
+				{
+					if(runLength > 0)
+					{
+						count = EmitTextRun(runStart, y, runLength, pixels, count);
+						runLength = 0;
+					}
+
+					/* Edge pixels of anti-aliased glyphs are blended one by one */
+					for(column = 0; level > 0 && column < span; column++)
+					{
+						DrawAAPixel(x + column, y, level, pRamp);
+					}
+				}
+			}
+
+			prev = glyph;
+			prevLine = line;
+			prevPen = pen;
+#if GLYPH_CACHE_ENTRIES > 0
+			prevRight = pen + glyph.Left + glyph.Width;
+#endif
+			glyph = next;
+			line = nextLine;
+			pen = xend;
+		}
+
+		if(textMode != OPAQUE_TEXT)
+		{
+			if(runLength > 0)
+			{
+				count = EmitTextRun(runStart, y, runLength, pixels, count);
+				runLength = 0;
+			}
+
+			/* Isolated pixels of the row share one cursor row */
+			lcd_drv->WriteRowPixels(y, pixels, count, DrawProp.TextColor);
+			count = 0;
+		}
+	}
+
+	if(textMode == OPAQUE_TEXT)
+	{
+		lcd_drv->WriteGRAM(pixels, count);
+
+		if(fillLength > 0)
+		{
+			lcd_drv->FillGRAM(fillColor, fillLength);
+		}
+
+		LCD_SetDisplayWindow(0, 0, LCD_GetWidth(), LCD_GetHeight());
+	}
+}
+
+/**
+ * @brief  Displays one character.
+ * @param  Xpos: Line where to display the character shape
+ * @param  Ypos: Start column address
+ * @param  Code: Character code, the font fallback glyph is shown if the font lacks it
+ */
+void LCD_DisplayChar(uint16_t Xpos, uint16_t Ypos, uint16_t Code)
+{
+	uint8_t text[3];
+	uint16_t size = 0;
+
+	/* Encoded back to UTF-8 for the string renderer */
+	if(Code < 0x80)
+	{
+		text[size++] = Code;
+	}
+	else if(Code < 0x800)
+	{
+		text[size++] = 0xC0 | (Code >> 6);
+		text[size++] = 0x80 | (Code & 0x3F);
+	}
+	else
+	{
+		text[size++] = 0xE0 | (Code >> 12);
+		text[size++] = 0x80 | ((Code >> 6) & 0x3F);
+		text[size++] = 0x80 | (Code & 0x3F);
+	}
+
+	DrawText(Xpos, Ypos, text, size);
+}
+
+/**
+ * @brief  Displays characters at a position that may be left of or above the screen.
+ * @param  Xpos: X position (in pixel)
+ * @param  Ypos: Y position (in pixel)
+ * @param  pText: UTF-8 string
+ * @param  Mode: Display mode, as for LCD_DisplayStringAt()
+ */
+static void DisplayString(int32_t Xpos, int32_t Ypos, const uint8_t *pText, Line_ModeTypdef Mode)
+{
+	GlyphTypeDef glyph;
+	int32_t refcolumn = Xpos, size = 0, xsize = 0, count = 0, width = 0;
+	const uint8_t *ptr = pText;
+	uint16_t code = 0, next = 0;
+
+	/* Get the text size */
+	while (*ptr++) size ++ ;
+
+	/* Line width, monospaced fonts keep to their character grid */
+	xsize = LCD_GetWidth();
+	if(DrawProp.pFont->advances == NULL)
+	{
+		xsize -= xsize % (DrawProp.pFont->Width * textScale);
+	}
+
+	/* No more characters than fit on a line, counted in bytes */
+	ptr = pText;
+	code = NextChar(&ptr, pText + size);
+	for(width = 0; code != 0; code = next)
+	{
+		GetGlyph(code, &glyph);
+		if(width + glyph.Advance * textScale > xsize)
+		{
+			break;
+		}
+		count = ptr - pText;
+		next = NextChar(&ptr, pText + size);
+		width += CellWidth(&glyph, code, next);
+	}
+
+	switch (Mode)
+	{
+	case CENTER_MODE:
+	{
+		refcolumn = Xpos + (xsize - MeasureText(pText, size)) / 2;
+		break;
+	}
+	case LEFT_MODE:
+	{
+		refcolumn = Xpos;
+		break;
+	}
+	case RIGHT_MODE:
+	{
+		refcolumn =  - Xpos + (xsize - MeasureText(pText, size));
+		break;
+	}
+	default:
+	{
+		refcolumn = Xpos;
+		break;
+	}
+	}
+
+	/* All of them sent at once */
+	DrawText(refcolumn, Ypos, pText, count);
+}
+
+/**
+ * @brief  Displays characters on the LCD.
+ * @param  Xpos: X position (in pixel)
+ * @param  Ypos: Y position (in pixel)
+ * @param  pText: Pointer to UTF-8 string to display on LCD
+ * @param  Mode: Display mode
+ *          This parameter can be one of the following values:
+ *            @arg  CENTER_MODE
+ *            @arg  RIGHT_MODE
+ *            @arg  LEFT_MODE
+ */
+void LCD_DisplayStringAt(uint16_t Xpos, uint16_t Ypos, uint8_t *pText, Line_ModeTypdef Mode)
 {
-	lcd_drv->DrawHLine(Xpos, Ypos, Length, DrawProp.TextColor);
+	DisplayString(Xpos, Ypos, pText, Mode);
 }
 
-/**
- * @brief  Draws a vertical line.
- * @param  Xpos: X position
- * @param  Ypos: Y position
- * @param  Length: Line length
- */
-void LCD_DrawVLine(int16_t Xpos, int16_t Ypos, uint16_t Length)
-{
-	lcd_drv->DrawVLine(Xpos, Ypos, Length, DrawProp.TextColor);
+/**
+ * @brief  Displays characters turned by 90 degrees, e.g. for labels of vertical axes.
+ * @param  Xpos: X position of the left edge of the text
+ * @param  Ypos: Y position of the top edge of the text
+ * @param  pText: Pointer to UTF-8 string to display on LCD
+ * @param  Direction: Reading direction
+ *          This parameter can be one of the following values:
+ *            @arg  BOTTOM_TO_TOP
+ *            @arg  TOP_TO_BOTTOM
+ */
+void LCD_DisplayStringVertical(uint16_t Xpos, uint16_t Ypos, uint8_t *pText, Text_DirectionTypdef Direction)
+{
+	Rect clip = DrawProp.Clip;
+	int32_t size = 0, width = 0, height = DrawProp.pFont->Height * textScale;
+	int32_t screenWidth = LCD_GetWidth(), screenHeight = LCD_GetHeight();
+
+	while(pText[size] != 0) size++;
+
+	width = MeasureText(pText, size);
+
+	/* Consecutive rotations are 90 degrees apart, so vertical text is horizontal
+	 * text of the neighbouring rotation. Switching to it only changes the address
+	 * counter direction (AM and I/D bits of R03): the glyph rows are streamed into
+	 * screen columns inside a turned window, at the cost of horizontal text. The
+	 * clip rectangle is turned with the coordinates */
+	if(Direction == TOP_TO_BOTTOM)
+	{
+		lcd_drv->SetRotation((lcdRotation + 3) % 4);
+		DrawProp.Clip.X = clip.Y;
+		DrawProp.Clip.Y = screenWidth - clip.X - clip.Width;
+		DrawProp.Clip.Width = clip.Height;
+		DrawProp.Clip.Height = clip.Width;
+
+		DrawText(Ypos, screenWidth - Xpos - height, pText, size);
+	}
+	else
+	{
+		lcd_drv->SetRotation((lcdRotation + 1) % 4);
+		DrawProp.Clip.X = screenHeight - clip.Y - clip.Height;
+		DrawProp.Clip.Y = clip.X;
+		DrawProp.Clip.Width = clip.Height;
+		DrawProp.Clip.Height = clip.Width;
+
+		DrawText(screenHeight - Ypos - width, Xpos, pText, size);
+	}
+
+	lcd_drv->SetRotation(lcdRotation);
+	DrawProp.Clip = clip;
+}
+
+/**
+ * @brief  Displays a character on the LCD.
+ * @param  Line: Line where to display the character shape
+ *          This parameter can be one of the following values:
+ *            @arg  0..9: if the Current fonts is Font16x24
+ *            @arg  0..19: if the Current fonts is Font12x12 or Font8x12
+ *            @arg  0..29: if the Current fonts is Font8x8
+ * @param  pText: Pointer to string to display on LCD
+ */
+void LCD_DisplayStringAtLine(uint16_t Line, uint8_t *pText)
+{
+	LCD_DisplayStringAt(0, LINE(Line),pText, LEFT_MODE);
+}
+
+
+/**
+ * @brief  Formats a number without the C library.
+ * @param  pText: Receives the characters, NUMBER_BUFFER_SIZE bytes
+ * @param  Value: Magnitude of the number
+ * @param  Base: 10 or 16
+ * @param  Decimals: Digits after the decimal point, at most 9
+ * @param  Negative: 1 to put a minus sign
+ * @param  Width: Characters to pad up to, at most NUMBER_BUFFER_SIZE
+ * @param  Pad: Padding and alignment
+ * @retval Number of characters
+ */
+static uint16_t FormatNumber(uint8_t *pText, uint32_t Value, uint8_t Base, uint8_t Decimals, uint8_t Negative, uint8_t Width, Number_PadTypdef Pad)
+{
+	uint8_t digits[10];
+	uint16_t count = 0, size = 0, length = 0;
+
+	if(Decimals > 9) Decimals = 9;
+	if(Width > NUMBER_BUFFER_SIZE) Width = NUMBER_BUFFER_SIZE;
+
+	/* Least significant digit first, at least one digit before the point */
+	do
+	{
+		digits[count++] = "0123456789ABCDEF"[Value % Base];
+		Value /= Base;
+	}
+	while(Value != 0 || count <= Decimals);
+
+	length = count + (Decimals > 0) + Negative;
+
+	for(; Pad == RIGHT_SPACE_PAD && length < Width; length++)
+	{
+		pText[size++] = ' ';
+	}
+
+	if(Negative)
+	{
+		pText[size++] = '-';
+	}
+
+	for(; Pad == RIGHT_ZERO_PAD && length < Width; length++)
+	{
+		pText[size++] = '0';
+	}
+
+	while(count > 0)
+	{
+		pText[size++] = digits[--count];
+
+		if(count == Decimals && count > 0)
+		{
+			pText[size++] = '.';
+		}
+	}
+
+	for(; Pad == LEFT_SPACE_PAD && length < Width; length++)
+	{
+		pText[size++] = ' ';
+	}
+
+	return size;
+}
+
+/**
+ * @brief  Formats an integer into a string, without the C library.
+ * @param  pText: Receives the characters and a terminating 0, NUMBER_BUFFER_SIZE + 1 bytes
+ * @param  Value: Number to format
+ * @param  Width: Characters to pad up to, longer numbers are formatted in full
+ * @param  Pad: Padding and alignment
+ *          This parameter can be one of the following values:
+ *            @arg  RIGHT_SPACE_PAD
+ *            @arg  RIGHT_ZERO_PAD
+ *            @arg  LEFT_SPACE_PAD
+ * @retval Number of characters
+ */
+uint16_t LCD_FormatInt(uint8_t *pText, int32_t Value, uint8_t Width, Number_PadTypdef Pad)
+{
+	return LCD_FormatFixed(pText, Value, 0, Width, Pad);
+}
+
+/**
+ * @brief  Formats a fixed point number into a string, e.g. 1234 with 2 decimals gives 12.34.
+ * @param  pText: Receives the characters and a terminating 0, NUMBER_BUFFER_SIZE + 1 bytes
+ * @param  Value: Number to format scaled by 10^Decimals
+ * @param  Decimals: Digits after the decimal point, at most 9
+ * @param  Width: Characters to pad up to, longer numbers are formatted in full
+ * @param  Pad: Padding and alignment
+ * @retval Number of characters
+ */
+uint16_t LCD_FormatFixed(uint8_t *pText, int32_t Value, uint8_t Decimals, uint8_t Width, Number_PadTypdef Pad)
+{
+	uint32_t magnitude = Value < 0 ? 0 - (uint32_t)Value : (uint32_t)Value;
+	uint16_t size = FormatNumber(pText, magnitude, 10, Decimals, Value < 0, Width, Pad);
+
+	pText[size] = 0;
+
+	return size;
+}
+
+/**
+ * @brief  Formats a number in upper case hexadecimal into a string, without prefix.
+ * @param  pText: Receives the characters and a terminating 0, NUMBER_BUFFER_SIZE + 1 bytes
+ * @param  Value: Number to format
+ * @param  Width: Characters to pad up to, longer numbers are formatted in full
+ * @param  Pad: Padding and alignment
+ * @retval Number of characters
+ */
+uint16_t LCD_FormatHex(uint8_t *pText, uint32_t Value, uint8_t Width, Number_PadTypdef Pad)
+{
+	uint16_t size = FormatNumber(pText, Value, 16, 0, 0, Width, Pad);
+
+	pText[size] = 0;
+
+	return size;
+}
+
+/**
+ * @brief  Displays an integer.
+ * @param  Xpos: X position (in pixel)
+ * @param  Ypos: Y position (in pixel)
+ * @param  Value: Number to display
+ * @param  Width: Characters to pad up to, longer numbers are displayed in full
+ * @param  Pad: Padding and alignment
+ *          This parameter can be one of the following values:
+ *            @arg  RIGHT_SPACE_PAD
+ *            @arg  RIGHT_ZERO_PAD
+ *            @arg  LEFT_SPACE_PAD
+ */
+void LCD_DrawInt(uint16_t Xpos, uint16_t Ypos, int32_t Value, uint8_t Width, Number_PadTypdef Pad)
+{
+	LCD_DrawFixed(Xpos, Ypos, Value, 0, Width, Pad);
+}
+
+/**
+ * @brief  Displays a fixed point number, e.g. 1234 with 2 decimals shows as 12.34.
+ * @param  Xpos: X position (in pixel)
+ * @param  Ypos: Y position (in pixel)
+ * @param  Value: Number to display scaled by 10^Decimals
+ * @param  Decimals: Digits after the decimal point, at most 9
+ * @param  Width: Characters to pad up to, longer numbers are displayed in full
+ * @param  Pad: Padding and alignment
+ */
+void LCD_DrawFixed(uint16_t Xpos, uint16_t Ypos, int32_t Value, uint8_t Decimals, uint8_t Width, Number_PadTypdef Pad)
+{
+	uint8_t text[NUMBER_BUFFER_SIZE + 1];
+
+	DrawText(Xpos, Ypos, text, LCD_FormatFixed(text, Value, Decimals, Width, Pad));
+}
+
+/**
+ * @brief  Displays a number in upper case hexadecimal, without prefix.
+ * @param  Xpos: X position (in pixel)
+ * @param  Ypos: Y position (in pixel)
+ * @param  Value: Number to display
+ * @param  Width: Characters to pad up to, longer numbers are displayed in full
+ * @param  Pad: Padding and alignment
+ */
+void LCD_DrawHex(uint16_t Xpos, uint16_t Ypos, uint32_t Value, uint8_t Width, Number_PadTypdef Pad)
+{
+	uint8_t text[NUMBER_BUFFER_SIZE + 1];
+
+	DrawText(Xpos, Ypos, text, LCD_FormatHex(text, Value, Width, Pad));
+}
+
+void LCD_ClearStringLine(uint16_t Line)
+{
+	uint16_t colorbackup = DrawProp.TextColor;
+	DrawProp.TextColor = DrawProp.BackColor;;
+
+	/* Draw a rectangle with background color */
+	LCD_FillRect(0, LINE(Line), LCD_GetWidth(), DrawProp.pFont->Height * textScale);
+
+	DrawProp.TextColor = colorbackup;
+}
+
+/**
+ * @brief  Prepares a text field, nothing is drawn before its first update.
+ * @param  pField: Text field
+ * @param  Xpos: X position
+ * @param  Ypos: Y position
+ */
+void LCD_InitTextField(TextField *pField, int16_t Xpos, int16_t Ypos)
+{
+	pField->X = Xpos;
+	pField->Y = Ypos;
+	pField->pFont = NULL;
+	pField->Scale = 1;
+	pField->Width = 0;
+	pField->Size = 0;
+}
+
+/**
+ * @brief  Checks whether a glyph stays inside its cell.
+ * @param  pGlyph: Glyph
+ * @param  Width: Cell width, text scale applied
+ * @retval 1 if no pixel of the glyph falls into a neighbouring cell
+ */
+static uint8_t GlyphInCell(const GlyphTypeDef *pGlyph, int32_t Width)
+{
+	return pGlyph->Width == 0 || (pGlyph->Left >= 0 && (pGlyph->Left + pGlyph->Width) * textScale <= Width);
+}
+
+/**
+ * @brief  Redraws the columns of a text field between two positions.
+ * @param  pField: Text field
+ * @param  pText: Pointer to the UTF-8 characters of the field
+ * @param  Size: Size of the characters in bytes
+ * @param  Start: First column to redraw
+ * @param  End: Column after the last one to redraw
+ */
+static void DrawTextFieldPart(const TextField *pField, const uint8_t *pText, uint16_t Size, int32_t Start, int32_t End)
+{
+	/* The whole text is drawn but only the columns inside the clip rectangle are sent */
+	if(LCD_PushClip(Start, pField->Y, End - Start, DrawProp.pFont->Height * textScale) != LCD_OK)
+	{
+		DrawText(pField->X, pField->Y, pText, Size);
+		return;
+	}
+
+	DrawText(pField->X, pField->Y, pText, Size);
+
+	LCD_PopClip();
+}
+
+/**
+ * @brief  Shows a string in a text field, only the characters that differ from the
+ *         ones shown are drawn. Cells left over by a longer string are cleared.
+ *         A new font, scale or new colors redraw the whole field. Fields are always opaque.
+ * @param  pField: Text field
+ * @param  pText: Pointer to UTF-8 string
+ */
+void LCD_UpdateTextField(TextField *pField, uint8_t *pText)
+{
+	GlyphTypeDef oldGlyph, newGlyph;
+	Rect rects[2];
+	const uint8_t *pOld = pField->Text, *pNew = pText;
+	uint16_t size = 0, count = 0, height = DrawProp.pFont->Height * textScale;
+	uint16_t oldCode = 0, oldNext = 0, newCode = 0, newNext = 0;
+	int32_t width = 0, oldPen = pField->X, newPen = pField->X, oldWidth = 0, newWidth = 0;
+	int32_t cellStart = 0, cellEnd = 0, runStart = 0, runEnd = 0;
+	uint8_t changed = 0, leak = 0, cellChanged = 0, cellLeak = 0, prevLeak = 0;
+	Text_ModeTypdef mode = textMode;
+
+	while(pText[size] != 0) size++;
+
+	width = MeasureText(pText, size);
+
+	/* Old cells are erased by the background of the new ones */
+	textMode = OPAQUE_TEXT;
+
+	if(pField->pFont != DrawProp.pFont || pField->Scale != textScale || pField->TextColor != DrawProp.TextColor ||
+	   pField->BackColor != DrawProp.BackColor || pField->Size > TEXT_FIELD_SIZE)
+	{
+		DrawText(pField->X, pField->Y, pText, size);
+	}
+	else
+	{
+		/* The shown and the new characters are walked side by side. A cell is
+		 * redrawn if it changed, or if a changed neighbour reaches into it. */
+		oldCode = NextChar(&pOld, pField->Text + pField->Size);
+		oldNext = NextChar(&pOld, pField->Text + pField->Size);
+		newCode = NextChar(&pNew, pText + size);
+		newNext = NextChar(&pNew, pText + size);
+		cellStart = cellEnd = pField->X;
+
+		/* One more pass past the end settles the last cell */
+		while(oldCode != 0 || newCode != 0 || cellEnd > cellStart)
+		{
+			oldWidth = newWidth = 0;
+			leak = 0;
+
+			if(oldCode != 0)
+			{
+				GetGlyph(oldCode, &oldGlyph);
+				oldWidth = CellWidth(&oldGlyph, oldCode, oldNext);
+				leak |= !GlyphInCell(&oldGlyph, oldWidth);
+			}
+			if(newCode != 0)
+			{
+				GetGlyph(newCode, &newGlyph);
+				newWidth = CellWidth(&newGlyph, newCode, newNext);
+				leak |= !GlyphInCell(&newGlyph, newWidth);
+			}
+
+			changed = oldCode != newCode || oldPen != newPen || oldWidth != newWidth;
+			leak &= changed;
+
+			/* The previous cell is settled now that both its neighbours are known,
+			 * adjacent cells to redraw are drawn together */
+			if(cellEnd > cellStart && (cellChanged || prevLeak || leak))
+			{
+				if(runEnd != cellStart)
+				{
+					if(runEnd > runStart)
+					{
+						DrawTextFieldPart(pField, pText, size, runStart, runEnd);
+					}
+					runStart = cellStart;
+				}
+				runEnd = cellEnd;
+			}
+
+			prevLeak = cellLeak;
+			cellChanged = changed;
+			cellLeak = leak;
+			cellStart = newPen;
+			cellEnd = newPen + newWidth;
+
+			oldPen += oldWidth;
+			newPen += newWidth;
+			oldCode = oldNext;
+			oldNext = NextChar(&pOld, pField->Text + pField->Size);
+			newCode = newNext;
+			newNext = NextChar(&pNew, pText + size);
+		}
+
+		if(runEnd > runStart)
+		{
+			DrawTextFieldPart(pField, pText, size, runStart, runEnd);
+		}
+	}
+
+	/* Leftovers of a wider or taller text */
+	if(pField->pFont != NULL)
+	{
+		if(pField->Width > width)
+		{
+			rects[count].X = pField->X + width;
+			rects[count].Y = pField->Y;
+			rects[count].Width = pField->Width - width;
+			rects[count].Height = pField->pFont->Height * pField->Scale;
+			count++;
+		}
+		if(pField->pFont->Height * pField->Scale > height)
+		{
+			rects[count].X = pField->X;
+			rects[count].Y = pField->Y + height;
+			rects[count].Width = pField->Width < width ? pField->Width : width;
+			rects[count].Height = pField->pFont->Height * pField->Scale - height;
+			count++;
+		}
+
+		LCD_FillRects(rects, count, DrawProp.BackColor);
+	}
+
+	textMode = mode;
+
+	pField->pFont = DrawProp.pFont;
+	pField->Scale = textScale;
+	pField->TextColor = DrawProp.TextColor;
+	pField->BackColor = DrawProp.BackColor;
+	pField->Width = width;
+	pField->Size = size <= TEXT_FIELD_SIZE ? size : TEXT_FIELD_SIZE + 1;
+
+	for(count = 0; count < size && count < TEXT_FIELD_SIZE; count++)
+	{
+		pField->Text[count] = pText[count];
+	}
+}
+
+/**
+ * @brief  Finds where the next line of a text box ends.
+ * @param  pText: Pointer to the UTF-8 characters left
+ * @param  Size: Size of the characters in bytes
+ * @param  Width: Line width
+ * @param  Wrap: Wrapping mode
+ * @param  pSkip: Receives the bytes up to the start of the following line
+ * @retval Size of the line in bytes, without the spaces or the '\n' it ends with
+ */
+static uint16_t NextTextLine(const uint8_t *pText, uint16_t Size, int32_t Width, Text_WrapTypdef Wrap, uint16_t *pSkip)
+{
+	GlyphTypeDef glyph;
+	const uint8_t *ptr = pText, *pEnd = pText + Size, *pChar = pText, *pAfter = NULL;
+	const uint8_t *pSpace = NULL, *pResume = NULL;
+	uint16_t code = NextChar(&ptr, pEnd), next = 0;
+	int32_t width = 0;
+
+	for(; code != 0; code = next, pChar = pAfter)
+	{
+		pAfter = ptr;
+		next = NextChar(&ptr, pEnd);
+
+		if(code == '\n')
+		{
+			*pSkip = pAfter - pText;
+			break;
+		}
+
+		GetGlyph(code, &glyph);
+
+		/* Spaces never overflow, a run of them is skipped when the line breaks there */
+		if(code == ' ')
+		{
+			if(pResume != pChar)
+			{
+				pSpace = pChar;
+			}
+			pResume = pAfter;
+		}
+		else if(Wrap != NO_WRAP && pChar > pText && width + CellWidth(&glyph, code, 0) > Width)
+		{
+			if(Wrap == WORD_WRAP && pSpace != NULL && pSpace > pText)
+			{
+				*pSkip = pResume - pText;
+				return pSpace - pText;
+			}
+
+			*pSkip = pChar - pText;
+			break;
+		}
+
+		width += CellWidth(&glyph, code, next != '\n' ? next : 0);
+	}
+
+	if(code == 0)
+	{
+		*pSkip = Size;
+	}
+
+	/* Trailing spaces would shift centered and right aligned lines */
+	return (pResume == pChar ? pSpace : pChar) - pText;
+}
+
+/**
+ * @brief  Lays out the lines of a text box.
+ * @param  pRect: Box
+ * @param  Ypos: Y position of the first line
+ * @param  pText: Pointer to the UTF-8 characters
+ * @param  Size: Size of the characters in bytes
+ * @param  Align: Line alignment
+ * @param  Wrap: Wrapping mode
+ * @param  Draw: 1 to draw the lines inside the clip rectangle, 0 to only measure them
+ * @retval Height of the lines in pixels
+ */
+static int32_t TextBoxLines(const Rect *pRect, int32_t Ypos, const uint8_t *pText, uint16_t Size,
+                            Line_ModeTypdef Align, Text_WrapTypdef Wrap, uint8_t Draw)
+{
+	Rect rects[2];
+	uint16_t pos = 0, length = 0, skip = 0, count = 0;
+	int32_t height = DrawProp.pFont->Height * textScale, y = Ypos, x = 0, width = 0;
+
+	for(pos = 0; pos < Size; pos += skip, y += height)
+	{
+		length = NextTextLine(pText + pos, Size - pos, pRect->Width, Wrap, &skip);
+
+		if(!Draw || y + height <= CLIP_TOP || y >= CLIP_BOTTOM)
+		{
+			continue;
+		}
+
+		width = MeasureText(pText + pos, length);
+
+		switch(Align)
+		{
+		case CENTER_MODE:
+			x = pRect->X + (pRect->Width - width) / 2;
+			break;
+		case RIGHT_MODE:
+			x = pRect->X + pRect->Width - width;
+			break;
+		default:
+			x = pRect->X;
+			break;
+		}
+
+		DrawText(x, y, pText + pos, length);
+
+		/* Opaque lines also paint the box on both sides of the text */
+		if(textMode == OPAQUE_TEXT)
+		{
+			count = 0;
+			if(x > pRect->X)
+			{
+				rects[count].X = pRect->X;
+				rects[count].Y = y;
+				rects[count].Width = x - pRect->X;
+				rects[count].Height = height;
+				count++;
+			}
+			if(x + width < pRect->X + pRect->Width)
+			{
+				rects[count].X = x + width;
+				rects[count].Y = y;
+				rects[count].Width = pRect->X + pRect->Width - x - width;
+				rects[count].Height = height;
+				count++;
+			}
+
+			LCD_FillRects(rects, count, DrawProp.BackColor);
+		}
+	}
+
+	return y - Ypos;
+}
+
+/**
+ * @brief  Draws a string into a rectangle, broken into lines of the current font.
+ *         Opaque text also paints the rest of the rectangle with the back color.
+ * @param  pRect: Rectangle, nothing is drawn outside of it
+ * @param  pText: Pointer to UTF-8 string, '\n' starts a new line
+ * @param  Align: Line alignment
+ *          This parameter can be one of the following values:
+ *            @arg  CENTER_MODE
+ *            @arg  RIGHT_MODE
+ *            @arg  LEFT_MODE
+ * @param  Wrap: Wrapping mode
+ *          This parameter can be one of the following values:
+ *            @arg  WORD_WRAP
+ *            @arg  CHAR_WRAP
+ *            @arg  NO_WRAP
+ * @param  Offset: Rows of text scrolled out at the top, negative to start lower
+ * @retval Height of all the lines in pixels, 0 if MAX_CLIP_DEPTH rectangles are already pushed
+ */
+uint16_t LCD_DrawTextBox(const Rect *pRect, uint8_t *pText, Line_ModeTypdef Align, Text_WrapTypdef Wrap, int16_t Offset)
+{
+	Rect rects[2];
+	uint16_t size = 0, count = 0;
+	int32_t y = pRect->Y - Offset, height = 0;
+
+	while(pText[size] != 0) size++;
+
+	if(LCD_PushClip(pRect->X, pRect->Y, pRect->Width, pRect->Height) != LCD_OK)
+	{
+		return 0;
+	}
+
+	height = TextBoxLines(pRect, y, pText, size, Align, Wrap, 1);
+
+	if(textMode == OPAQUE_TEXT)
+	{
+		if(y > pRect->Y)
+		{
+			rects[count].X = pRect->X;
+			rects[count].Y = pRect->Y;
+			rects[count].Width = pRect->Width;
+			rects[count].Height = y - pRect->Y;
+			count++;
+		}
+		if(y + height < pRect->Y + pRect->Height)
+		{
+			rects[count].X = pRect->X;
+			rects[count].Y = y + height;
+			rects[count].Width = pRect->Width;
+			rects[count].Height = pRect->Y + pRect->Height - y - height;
+			count++;
+		}
+
+		LCD_FillRects(rects, count, DrawProp.BackColor);
+	}
+
+	LCD_PopClip();
+
+	return height;
+}
+
+/**
+ * @brief  Prepares an empty text box, nothing is drawn.
+ * @param  pBox: Text box
+ * @param  Xpos: X position
+ * @param  Ypos: Y position
+ * @param  Width: Box width
+ * @param  Height: Box height
+ */
+void LCD_InitTextBox(TextBox *pBox, int16_t Xpos, int16_t Ypos, uint16_t Width, uint16_t Height)
+{
+	pBox->Area.X = Xpos;
+	pBox->Area.Y = Ypos;
+	pBox->Area.Width = Width;
+	pBox->Area.Height = Height;
+	pBox->Used = 0;
+}
+
+/**
+ * @brief  Adds lines below the ones of a text box. When the box is full, the shown
+ *         lines are copied up on the display and only the new ones are drawn.
+ * @param  pBox: Text box
+ * @param  pText: Pointer to UTF-8 string, '\n' starts a new line
+ * @param  Align: Line alignment
+ * @param  Wrap: Wrapping mode
+ */
+void LCD_AppendTextBox(TextBox *pBox, uint8_t *pText, Line_ModeTypdef Align, Text_WrapTypdef Wrap)
+{
+	const Rect *pRect = &pBox->Area;
+	Rect rect;
+	uint16_t size = 0;
+	int32_t height = 0, scroll = 0;
+
+	while(pText[size] != 0) size++;
+
+	if(LCD_PushClip(pRect->X, pRect->Y, pRect->Width, pRect->Height) != LCD_OK)
+	{
+		return;
+	}
+
+	height = TextBoxLines(pRect, 0, pText, size, Align, Wrap, 0);
+	scroll = pBox->Used + height - pRect->Height;
+
+	/* The panel scrolls as a whole, the box is scrolled by a region copy */
+	if(scroll > 0)
+	{
+		if(scroll < pBox->Used)
+		{
+			LCD_CopyRect(pRect->X, pRect->Y + scroll, pRect->Width, pBox->Used - scroll, pRect->X, pRect->Y);
+		}
+
+		/* Transparent lines are drawn on cleared rows */
+		if(textMode != OPAQUE_TEXT)
+		{
+			rect = *pRect;
+			if(scroll < pBox->Used)
+			{
+				rect.Y += pBox->Used - scroll;
+				rect.Height -= pBox->Used - scroll;
+			}
+			LCD_FillRects(&rect, 1, DrawProp.BackColor);
+		}
+
+		pBox->Used -= scroll;
+	}
+
+	TextBoxLines(pRect, pRect->Y + pBox->Used, pText, size, Align, Wrap, 1);
+
+	pBox->Used += height;
+
+	LCD_PopClip();
+}
+
+/**
+ * @brief  Reads an LCD pixel.
+ * @param  Xpos: X position
+ * @param  Ypos: Y position
+ * @retval RGB pixel color
+ */
+uint16_t LCD_ReadPixel(uint16_t Xpos, uint16_t Ypos)
+{
+	return lcd_drv->ReadPixel(Xpos, Ypos);
+}
+
+/**
+ * @brief  Draws a pixel on LCD.
+ * @param  Xpos: X position
+ * @param  Ypos: Y position
+ * @param  RGBCode: Pixel color in RGB mode (5-6-5)
+ */
+void LCD_DrawPixel(uint16_t Xpos, uint16_t Ypos, uint16_t RGBCode)
+{
+	if(CLIP_OUT(Xpos, Ypos, 1, 1))
+	{
+		return;
+	}
+
+	lcd_drv->WritePixel(Xpos, Ypos, RGBCode);
+}
+
+/**
+ * @brief  Draws an uni-line (between two points).
+ * @param  x1: Point 1 X position
+ * @param  y1: Point 1 Y position
+ * @param  x2: Point 2 X position
+ * @param  y2: Point 2 Y position
+ */
+void LCD_DrawLine(int16_t x1, int16_t y1, int16_t x2, int16_t y2)
+{
+	int16_t deltax = 0, deltay = 0, x = 0, y = 0, xinc1 = 0, xinc2 = 0,
+			yinc1 = 0, yinc2 = 0, den = 0, num = 0, numadd = 0, numpixels = 0,
+			curpixel = 0;
+
+	deltax = ABS(x2 - x1);        /* The difference between the x's */
+	deltay = ABS(y2 - y1);        /* The difference between the y's */
+
+	if(CLIP_OUT((x1 < x2 ? x1 : x2), (y1 < y2 ? y1 : y2), deltax + 1, deltay + 1))
+	{
+		return;
+	}
+
+	x = x1;                       /* Start x off at the first pixel */
+	y = y1;                       /* Start y off at the first pixel */
+
+	if (x2 >= x1)                 /* The x-values are increasing */
+	{
+		xinc1 = 1;
+		xinc2 = 1;
+	}
+	else                          /* The x-values are decreasing */
+	{
+		xinc1 = -1;
+		xinc2 = -1;
+	}
+
+	if (y2 >= y1)                 /* The y-values are increasing */
+	{
+		yinc1 = 1;
+		yinc2 = 1;
+	}
+	else                          /* The y-values are decreasing */
+	{
+		yinc1 = -1;
+		yinc2 = -1;
+	}
+
+	if (deltax >= deltay)         /* There is at least one x-value for every y-value */
+	{
+		xinc1 = 0;                  /* Don't change the x when numerator >= denominator */
+		yinc2 = 0;                  /* Don't change the y for every iteration */
+		den = deltax;
+		num = deltax / 2;
+		numadd = deltay;
+		numpixels = deltax;         /* There are more x-values than y-values */
+	}
+	else                          /* There is at least one y-value for every x-value */
+	{
+		xinc2 = 0;                  /* Don't change the x for every iteration */
+		yinc1 = 0;                  /* Don't change the y when numerator >= denominator */
+		den = deltay;
+		num = deltay / 2;
+		numadd = deltax;
+		numpixels = deltay;         /* There are more y-values than x-values */
+	}
+
+	for (curpixel = 0; curpixel <= numpixels; curpixel++)
+	{
+		if (x >= 0 && y >= 0)
+		{
+			LCD_DrawPixel(x, y, DrawProp.TextColor);  /* Draw the current pixel */
+		}
+		num += numadd;                            /* Increase the numerator by the top of the fraction */
+		if (num >= den)                           /* Check if numerator >= denominator */
+		{
+			num -= den;                             /* Calculate the new numerator value */
+			x += xinc1;                             /* Change the x as appropriate */
+			y += yinc1;                             /* Change the y as appropriate */
+		}
+		x += xinc2;                               /* Change the x as appropriate */
+		y += yinc2;                               /* Change the y as appropriate */
+	}
+}
+
+/**
+ * @brief  Draws an horizontal line.
+ * @param  Xpos: X position
+ * @param  Ypos: Y position
+ * @param  Length: Line length
+ */
+void LCD_DrawHLine(int16_t Xpos, int16_t Ypos, uint16_t Length)
+{
+	int32_t x1 = Xpos, x2 = Xpos + Length;
+
+	if(Ypos < CLIP_TOP || Ypos >= CLIP_BOTTOM)
+	{
+		return;
+	}
+
+	if(x1 < CLIP_LEFT) x1 = CLIP_LEFT;
+	if(x2 > CLIP_RIGHT) x2 = CLIP_RIGHT;
+
+	if(x2 > x1)
+	{
+		lcd_drv->DrawHLine(x1, Ypos, x2 - x1, DrawProp.TextColor);
+	}
+}
+
+/**
+ * @brief  Draws a vertical line.
+ * @param  Xpos: X position
+ * @param  Ypos: Y position
+ * @param  Length: Line length
+ */
+void LCD_DrawVLine(int16_t Xpos, int16_t Ypos, uint16_t Length)
+{
+	int32_t y1 = Ypos, y2 = Ypos + Length;
+
+	if(Xpos < CLIP_LEFT || Xpos >= CLIP_RIGHT)
+	{
+		return;
+	}
+
+	if(y1 < CLIP_TOP) y1 = CLIP_TOP;
+	if(y2 > CLIP_BOTTOM) y2 = CLIP_BOTTOM;
+
+	if(y2 > y1)
+	{
+		lcd_drv->DrawVLine(Xpos, y1, y2 - y1, DrawProp.TextColor);
+	}
+}
+
+/**
+ * @brief  Draws a rectangle.
+ * @param  Xpos: X position
+ * @param  Ypos: Y position
+ * @param  Width: Rectangle width
+ * @param  Height: Rectangle height
+ */
+void LCD_DrawRect(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height)
+{
+	/* Draw horizontal lines */
+	LCD_DrawHLine(Xpos, Ypos, Width);
+	LCD_DrawHLine(Xpos, (Ypos + Height - 1), Width);
+
+	/* Draw vertical lines */
+	LCD_DrawVLine(Xpos, Ypos, Height);
+	LCD_DrawVLine((Xpos + Width - 1), Ypos, Height);
+}
+
+/**
+ * @brief  Draws a circle.
+ * @param  Xpos: X position
+ * @param  Ypos: Y position
+ * @param  Radius: Circle radius
+ */
+void LCD_DrawCircle(uint16_t Xpos, uint16_t Ypos, uint16_t Radius)
+{
+	int32_t  D;       /* Decision Variable */
+	uint32_t  CurX;   /* Current X Value */
+	uint32_t  CurY;   /* Current Y Value */
+
+	if(CLIP_OUT((int32_t)Xpos - Radius, (int32_t)Ypos - Radius, 2 * Radius + 1, 2 * Radius + 1))
+	{
+		return;
+	}
+
+	D = 3 - (Radius << 1);
+	CurX = 0;
+	CurY = Radius;
+
+	while (CurX <= CurY)
+	{
+		LCD_DrawPixel((Xpos + CurX), (Ypos - CurY), DrawProp.TextColor);
+
+		LCD_DrawPixel((Xpos - CurX), (Ypos - CurY), DrawProp.TextColor);
+
+		LCD_DrawPixel((Xpos + CurY), (Ypos - CurX), DrawProp.TextColor);
+
+		LCD_DrawPixel((Xpos - CurY), (Ypos - CurX), DrawProp.TextColor);
+
+		LCD_DrawPixel((Xpos + CurX), (Ypos + CurY), DrawProp.TextColor);
+
+		LCD_DrawPixel((Xpos - CurX), (Ypos + CurY), DrawProp.TextColor);
+
+		LCD_DrawPixel((Xpos + CurY), (Ypos + CurX), DrawProp.TextColor);
+
+		LCD_DrawPixel((Xpos - CurY), (Ypos + CurX), DrawProp.TextColor);
+
+		if (D < 0)
+		{
+			D += (CurX << 2) + 6;
+		}
+		else
+		{
+			D += ((CurX - CurY) << 2) + 10;
+			CurY--;
+		}
+		CurX++;
+	}
+}
+
+/**
+ * @brief  Draws an poly-line (between many points).
+ * @param  Points: Pointer to the points array
+ * @param  PointCount: Number of points
+ */
+void LCD_DrawPolygon(pPoint Points, uint16_t PointCount)
+{
+	int16_t X = 0, Y = 0;
+
+	if(PointCount < 2)
+	{
+		return;
+	}
+
+	LCD_DrawLine(Points->X, Points->Y, (Points+PointCount-1)->X, (Points+PointCount-1)->Y);
+
+	while(--PointCount)
+	{
+		X = Points->X;
+		Y = Points->Y;
+		Points++;
+		LCD_DrawLine(X, Y, Points->X, Points->Y);
+	}
+
+}
+
+/**
+ * @brief  Draws an ellipse on LCD.
+ * @param  Xpos: X position
+ * @param  Ypos: Y position
+ * @param  XRadius: Ellipse X radius
+ * @param  YRadius: Ellipse Y radius
+ */
+void LCD_DrawEllipse(int Xpos, int Ypos, int XRadius, int YRadius)
+{
+	int32_t x = -XRadius, y = 0;              /* II. quadrant from left to top */
+	int32_t bb = YRadius * YRadius, aa = XRadius * XRadius;
+	int32_t ex = (1 - 2 * XRadius) * bb;      /* (2x+1)*b^2 */
+	int32_t ey = aa;                          /* (2y+1)*a^2 */
+	int32_t err = ex + aa, e2;                /* error of the first step */
+
+	if(CLIP_OUT(Xpos - XRadius, Ypos - YRadius, 2 * XRadius + 1, 2 * YRadius + 1))
+	{
+		return;
+	}
+
+	do
+	{
+		LCD_DrawPixel((Xpos-x), (Ypos+y), DrawProp.TextColor);
+		LCD_DrawPixel((Xpos+x), (Ypos+y), DrawProp.TextColor);
+		LCD_DrawPixel((Xpos+x), (Ypos-y), DrawProp.TextColor);
+		LCD_DrawPixel((Xpos-x), (Ypos-y), DrawProp.TextColor);
+
+		e2 = 2 * err;
+		if (e2 >= ex) { x++; ex += 2 * bb; err += ex; }
+		if (e2 <= ey) { y++; ey += 2 * aa; err += ey; }
+	}
+	while (x <= 0);
+
+	/* Finish the tips of flat ellipses */
+	while (y++ < YRadius)
+	{
+		LCD_DrawPixel(Xpos, (Ypos+y), DrawProp.TextColor);
+		LCD_DrawPixel(Xpos, (Ypos-y), DrawProp.TextColor);
+	}
+}
+
+/**
+ * @brief  Draws the part of a RGB Image (16 bpp) inside the clip rectangle.
+ * @param  Xpos:  X position in the LCD
+ * @param  Ypos:  Y position in the LCD
+ * @param  Width: Image width
+ * @param  Height: Image height
+ * @param  pdata: Pointer to the RGB Image address.
+ */
+static void DrawClippedImage(int32_t Xpos, int32_t Ypos, int32_t Width, int32_t Height, uint16_t *pdata)
+{
+	int32_t x1 = Xpos, y1 = Ypos, x2 = Xpos + Width, y2 = Ypos + Height, y = 0;
+
+	if(x1 < CLIP_LEFT) x1 = CLIP_LEFT;
+	if(y1 < CLIP_TOP) y1 = CLIP_TOP;
+	if(x2 > CLIP_RIGHT) x2 = CLIP_RIGHT;
+	if(y2 > CLIP_BOTTOM) y2 = CLIP_BOTTOM;
+
+	if(x2 <= x1 || y2 <= y1)
+	{
+		return;
+	}
+
+	pdata += (y1 - Ypos) * Width + (x1 - Xpos);
+
+	LCD_SetDisplayWindow(x1, y1, x2 - x1, y2 - y1);
+
+	if(x2 - x1 == Width)
+	{
+		/* Whole rows are visible, one stream */
+		lcd_drv->DrawRGBImage(x1, y1, pdata, Width * (y2 - y1));
+	}
+	else
+	{
+		for(y = y1; y < y2; y++, pdata += Width)
+		{
+			lcd_drv->DrawRGBImage(x1, y, pdata, x2 - x1);
+		}
+	}
+
+	LCD_SetDisplayWindow(0, 0, LCD_GetWidth(), LCD_GetHeight());
+}
+
+/**
+ * @brief  Draws a bitmap picture (16 bpp).
+ * @param  Xpos: Bmp X position in the LCD
+ * @param  Ypos: Bmp Y position in the LCD
+ * @param  pbmp: Pointer to Bmp picture address.
+ */
+void LCD_DrawBitmap(uint16_t Xpos, uint16_t Ypos, uint8_t *pbmp)
+{
+	uint32_t height = 0;
+	uint32_t width  = 0;
+	uint32_t index  = 0;
+
+	/* Read bitmap width */
+	width = *(uint16_t *) (pbmp + 18);
+	width |= (*(uint16_t *) (pbmp + 20)) << 16;
+
+	/* Read bitmap height */
+	height = *(uint16_t *) (pbmp + 22);
+	height |= (*(uint16_t *) (pbmp + 24)) << 16;
+
+	if(Xpos < CLIP_LEFT || Ypos < CLIP_TOP || Xpos + (int32_t)width > CLIP_RIGHT || Ypos + (int32_t)height > CLIP_BOTTOM)
+	{
+		/* Get bitmap data address offset */
+		index = *(uint16_t *) (pbmp + 10);
+		index |= (*(uint16_t *) (pbmp + 12)) << 16;
+
+		DrawClippedImage(Xpos, Ypos, width, height, (uint16_t *)(pbmp + index));
+		return;
+	}
+
+	LCD_SetDisplayWindow(Xpos, Ypos, width, height);
+
+	lcd_drv->DrawBitmap(Xpos, Ypos, pbmp);
+
+	LCD_SetDisplayWindow(0, 0, LCD_GetWidth(), LCD_GetHeight());
+}
+
+/**
+ * @brief  Draws RGB Image (16 bpp).
+ * @param  Xpos:  X position in the LCD
+ * @param  Ypos:  Y position in the LCD
+ * @param  Xsize: X size in the LCD
+ * @param  Ysize: Y size in the LCD
+ * @param  pdata: Pointer to the RGB Image address.
+ */
+void LCD_DrawRGBImage(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height, uint16_t *pdata)
+{
+	if(Xpos < CLIP_LEFT || Ypos < CLIP_TOP || Xpos + Width > CLIP_RIGHT || Ypos + Height > CLIP_BOTTOM)
+	{
+		DrawClippedImage(Xpos, Ypos, Width, Height, pdata);
+		return;
+	}
+
+	LCD_SetDisplayWindow(Xpos, Ypos, Width, Height);
+
+	lcd_drv->DrawRGBImage(Xpos, Ypos, pdata, Width * Height);
+
+	LCD_SetDisplayWindow(0, 0, LCD_GetWidth(), LCD_GetHeight());
+}
+
+/**
+ * @brief  Reads RGB Image (16 bpp) from the LCD.
+ * @param  Xpos:  X position in the LCD
+ * @param  Ypos:  Y position in the LCD
+ * @param  Xsize: X size in the LCD
+ * @param  Ysize: Y size in the LCD
+ * @param  pdata: Pointer to the buffer receiving Width * Height pixels.
+ */
+void LCD_ReadRGBImage(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height, uint16_t *pdata)
+{
+	LCD_SetDisplayWindow(Xpos, Ypos, Width, Height);
+
+	lcd_drv->ReadRGBImage(Xpos, Ypos, pdata, Width * Height);
+
+	LCD_SetDisplayWindow(0, 0, LCD_GetWidth(), LCD_GetHeight());
+}
+
+/**
+ * @brief  Copies a rectangle of the LCD to another position, the areas may overlap.
+ * @param  Xpos:  Source X position
+ * @param  Ypos:  Source Y position
+ * @param  Width: Rectangle width
+ * @param  Height: Rectangle height
+ * @param  DstX:  Destination X position
+ * @param  DstY:  Destination Y position
+ */
+void LCD_CopyRect(int16_t Xpos, int16_t Ypos, uint16_t Width, uint16_t Height, int16_t DstX, int16_t DstY)
+{
+	int32_t dx = DstX - Xpos, dy = DstY - Ypos;
+	int32_t x1 = Xpos, y1 = Ypos, x2 = Xpos + Width, y2 = Ypos + Height;
+	int32_t x = 0, y = 0, n = 0, i = 0, j = 0, rows = 0, runs = 0;
+
+	/* Source inside the screen, destination inside the clip rectangle */
+	if(x1 < 0) x1 = 0;
+	if(y1 < 0) y1 = 0;
+	if(x2 > LCD_GetWidth()) x2 = LCD_GetWidth();
+	if(y2 > LCD_GetHeight()) y2 = LCD_GetHeight();
+	if(x1 < CLIP_LEFT - dx) x1 = CLIP_LEFT - dx;
+	if(y1 < CLIP_TOP - dy) y1 = CLIP_TOP - dy;
+	if(x2 > CLIP_RIGHT - dx) x2 = CLIP_RIGHT - dx;
+	if(y2 > CLIP_BOTTOM - dy) y2 = CLIP_BOTTOM - dy;
+
+	if(x2 <= x1 || y2 <= y1 || (dx == 0 && dy == 0))
+	{
+		return;
+	}
+
+	rows = y2 - y1;
+	runs = (x2 - x1 + COPY_BUFFER_SIZE - 1) / COPY_BUFFER_SIZE;
+
+	/* Runs along a row never wrap, so the full screen window serves every rotation.
+	 * Rows and runs are visited so that no source pixel is overwritten before it is read */
+	for(i = 0; i < rows; i++)
+	{
+		y = dy > 0 ? y2 - 1 - i : y1 + i;
+
+		for(j = 0; j < runs; j++)
+		{
+			x = (dy == 0 && dx > 0) ? x2 - (j + 1) * COPY_BUFFER_SIZE : x1 + j * COPY_BUFFER_SIZE;
+			n = COPY_BUFFER_SIZE;
+
+			if(x < x1)
+			{
+				n -= x1 - x;
+				x = x1;
+			}
+			if(x + n > x2)
+			{
+				n = x2 - x;
+			}
+
+			lcd_drv->ReadRGBImage(x, y, copyBuffer, n);
+			lcd_drv->DrawRGBImage(x + dx, y + dy, copyBuffer, n);
+		}
+	}
+}
+
+/**
+ * @brief  Draws a full rectangle.
+ * @param  Xpos: X position
+ * @param  Ypos: Y position
+ * @param  Width: Rectangle width
+ * @param  Height: Rectangle height
+ */
+void LCD_FillRect(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height)
+{
+	int32_t x1 = Xpos, y1 = Ypos, x2 = Xpos + Width, y2 = Ypos + Height;
+
+	if(x1 < CLIP_LEFT) x1 = CLIP_LEFT;
+	if(y1 < CLIP_TOP) y1 = CLIP_TOP;
+	if(x2 > CLIP_RIGHT) x2 = CLIP_RIGHT;
+	if(y2 > CLIP_BOTTOM) y2 = CLIP_BOTTOM;
+
+	for(; x2 > x1 && y1 < y2; y1++)
+	{
+		lcd_drv->DrawHLine(x1, y1, x2 - x1, DrawProp.TextColor);
+	}
+}
+
+/**
+ * @brief  Sorts and merges the batch items, then fills them with one color.
+ * @param  Count: Number of items in batchItems
+ * @param  Color: Fill color
+ */
+static void FillBatch(uint16_t Count, uint16_t Color)
+{
+	int32_t wx1 = 0, wy1 = 0, wx2 = LCD_GetWidth(), wy2 = LCD_GetHeight();
+	int32_t x1 = 0, y1 = 0, x2 = 0, y2 = 0;
+	uint16_t i = 0, j = 0;
+	uint8_t merged = 0;
+	Rect item, *a, *b;
+
+	/* Top to bottom, left to right */
+	for(i = 1; i < Count; i++)
+	{
+		item = batchItems[i];
+		for(j = i; j > 0 && (batchItems[j - 1].Y > item.Y || (batchItems[j - 1].Y == item.Y && batchItems[j - 1].X > item.X)); j--)
+		{
+			batchItems[j] = batchItems[j - 1];
+		}
+		batchItems[j] = item;
+	}
+
+	/* Join items whose union is still a rectangle, an emptied item has zero width */
+	do
+	{
+		merged = 0;
+
+		for(i = 0; i < Count; i++)
+		{
+			a = &batchItems[i];
+
+			for(j = i + 1; j < Count && a->Width > 0 && a->Height > 0; j++)
+			{
+				b = &batchItems[j];
+
+				if(b->Width == 0 || b->Height == 0)
+				{
+					continue;
+				}
+
+				x1 = a->X < b->X ? a->X : b->X;
+				y1 = a->Y < b->Y ? a->Y : b->Y;
+				x2 = a->X + a->Width > b->X + b->Width ? a->X + a->Width : b->X + b->Width;
+				y2 = a->Y + a->Height > b->Y + b->Height ? a->Y + a->Height : b->Y + b->Height;
+
+				if((a->Y == b->Y && a->Height == b->Height && x2 - x1 <= a->Width + b->Width) ||
+				   (a->X == b->X && a->Width == b->Width && y2 - y1 <= a->Height + b->Height) ||
+				   (x2 - x1 == a->Width && y2 - y1 == a->Height) ||
+				   (x2 - x1 == b->Width && y2 - y1 == b->Height))
+				{
+					a->X = x1;
+					a->Y = y1;
+					a->Width = x2 - x1;
+					a->Height = y2 - y1;
+					b->Width = 0;
+					merged = 1;
+				}
+			}
+		}
+	}
+	while(merged);
+
+	for(i = 0; i < Count; i++)
+	{
+		x1 = batchItems[i].X;
+		y1 = batchItems[i].Y;
+		x2 = x1 + batchItems[i].Width;
+		y2 = y1 + batchItems[i].Height;
+
+		if(x1 < CLIP_LEFT) x1 = CLIP_LEFT;
+		if(y1 < CLIP_TOP) y1 = CLIP_TOP;
+		if(x2 > CLIP_RIGHT) x2 = CLIP_RIGHT;
+		if(y2 > CLIP_BOTTOM) y2 = CLIP_BOTTOM;
+
+		if(x2 <= x1 || y2 <= y1)
+		{
+			continue;
+		}
+
+		/* The current window is kept while the item streams inside it without wrapping */
+		if(x1 < wx1 || x2 > wx2 || y1 < wy1 || y2 > wy2 || (y2 - y1 > 1 && (x1 != wx1 || x2 != wx2)))
+		{
+			if(y2 - y1 > 1)
+			{
+				wx1 = x1;
+				wy1 = y1;
+				wx2 = x2;
+				wy2 = y2;
+			}
+			else
+			{
+				/* Any single row streams inside the whole screen */
+				wx1 = 0;
+				wy1 = 0;
+				wx2 = LCD_GetWidth();
+				wy2 = LCD_GetHeight();
+			}
+
+			LCD_SetDisplayWindow(wx1, wy1, wx2 - wx1, wy2 - wy1);
+		}
+
+		lcd_drv->SetCursor(x1, y1);
+		lcd_drv->FillGRAM(Color, (x2 - x1) * (y2 - y1));
+	}
+
+	if(wx1 != 0 || wy1 != 0 || wx2 != LCD_GetWidth() || wy2 != LCD_GetHeight())
+	{
+		LCD_SetDisplayWindow(0, 0, LCD_GetWidth(), LCD_GetHeight());
+	}
+}
+
+/**
+ * @brief  Draws a batch of full rectangles of one color.
+ * @param  pRects: Pointer to the rectangles array
+ * @param  Count: Number of rectangles
+ * @param  Color: Fill color
+ */
+void LCD_FillRects(const Rect *pRects, uint16_t Count, uint16_t Color)
+{
+	uint16_t i = 0, n = 0;
+
+	/* Items are merged MAX_BATCH_ITEMS at a time */
+	while(Count > 0)
+	{
+		n = Count < MAX_BATCH_ITEMS ? Count : MAX_BATCH_ITEMS;
+
+		for(i = 0; i < n; i++)
+		{
+			batchItems[i] = pRects[i];
+		}
+
+		FillBatch(n, Color);
+
+		pRects += n;
+		Count -= n;
+	}
+}
+
+/**
+ * @brief  Draws a batch of horizontal spans with the current text color.
+ * @param  pSpans: Pointer to the spans array
+ * @param  Count: Number of spans
+ */
+void LCD_FillSpans(const Span *pSpans, uint16_t Count)
+{
+	uint16_t i = 0, n = 0;
+
+	/* Items are merged MAX_BATCH_ITEMS at a time */
+	while(Count > 0)
+	{
+		n = Count < MAX_BATCH_ITEMS ? Count : MAX_BATCH_ITEMS;
+
+		for(i = 0; i < n; i++)
+		{
+			batchItems[i].X = pSpans[i].X;
+			batchItems[i].Y = pSpans[i].Y;
+			batchItems[i].Width = pSpans[i].Length;
+			batchItems[i].Height = 1;
+		}
+
+		FillBatch(n, DrawProp.TextColor);
+
+		pSpans += n;
+		Count -= n;
+	}
+}
+
+/**
+ * @brief  Draws a full circle whose center may be left of or above the screen.
+ * @param  Xpos: X position
+ * @param  Ypos: Y position
+ * @param  Radius: Circle radius
+ */
+static void FillCircle(int32_t Xpos, int32_t Ypos, uint16_t Radius)
+{
+	int32_t  D;        /* Decision Variable */
+	int32_t   CurX;    /* Current X Value */
+	int32_t   CurY;    /* Current Y Value */
+
+	D = 3 - (Radius << 1);
+
+	CurX = 0;
+	CurY = Radius;
+
+	if(CLIP_OUT(Xpos - Radius, Ypos - Radius, 2 * Radius + 1, 2 * Radius + 1))
+	{
+		return;
+	}
+
+	/* Every scanline is written exactly once and already includes the outline:
+	 * rows Ypos+-CurX get the half-width CurY of the current step, rows Ypos+-CurY
+	 * are emitted with the widest CurX just before CurY is decremented. */
+	while (CurX <= CurY)
+	{
+		LCD_DrawHLine(Xpos - CurY, Ypos + CurX, 2*CurY + 1);
+		if(CurX > 0)
+		{
+			LCD_DrawHLine(Xpos - CurY, Ypos - CurX, 2*CurY + 1);
+		}
+
+		if (D < 0)
+		{
+			D += (CurX << 2) + 6;
+		}
+		else
+		{
+			if(CurY > CurX)
+			{
+				LCD_DrawHLine(Xpos - CurX, Ypos - CurY, 2*CurX + 1);
+				LCD_DrawHLine(Xpos - CurX, Ypos + CurY, 2*CurX + 1);
+			}
+			D += 4*(CurX - CurY) + 10;
+			CurY--;
+		}
+		CurX++;
+	}
+}
+
+/**
+ * @brief  Draws a full circle.
+ * @param  Xpos: X position
+ * @param  Ypos: Y position
+ * @param  Radius: Circle radius
+ */
+void LCD_FillCircle(uint16_t Xpos, uint16_t Ypos, uint16_t Radius)
+{
+	FillCircle(Xpos, Ypos, Radius);
+}
+
+/**
+ * @brief  Draws a full ellipse.
+ * @param  Xpos: X position
+ * @param  Ypos: Y position
+ * @param  XRadius: Ellipse X radius
+ * @param  YRadius: Ellipse Y radius
+ */
+void LCD_FillEllipse(int Xpos, int Ypos, int XRadius, int YRadius)
+{
+	int32_t x = -XRadius, y = 0;              /* II. quadrant from left to top */
+	int32_t bb = YRadius * YRadius, aa = XRadius * XRadius;
+	int32_t ex = (1 - 2 * XRadius) * bb;      /* (2x+1)*b^2 */
+	int32_t ey = aa;                          /* (2y+1)*a^2 */
+	int32_t err = ex + aa, e2;                /* error of the first step */
+
+	if(CLIP_OUT(Xpos - XRadius, Ypos - YRadius, 2 * XRadius + 1, 2 * YRadius + 1))
+	{
+		return;
+	}
+
+	/* The widest point of a row is the first one reached on it,
+	 * so each scanline is emitted once, when y changes. */
+	LCD_DrawHLine(Xpos + x, Ypos, 1 - 2 * x);
+
+	do
+	{
+		e2 = 2 * err;
+		if (e2 >= ex) { x++; ex += 2 * bb; err += ex; }
+		if (e2 <= ey)
+		{
+			y++; ey += 2 * aa; err += ey;
+
+			if (x <= 0)
+			{
+				LCD_DrawHLine(Xpos + x, Ypos + y, 1 - 2 * x);
+				LCD_DrawHLine(Xpos + x, Ypos - y, 1 - 2 * x);
+			}
+		}
+	}
+	while (x <= 0);
+
+	/* Finish the tips of flat ellipses */
+	while (y++ < YRadius)
+	{
+		LCD_DrawHLine(Xpos, Ypos + y, 1);
+		LCD_DrawHLine(Xpos, Ypos - y, 1);
+	}
+}
+
+/**
+ * @brief  Draws a full polygon.
+ *         Pixels are filled when their center lies inside the polygon, so
+ *         polygons sharing an edge neither overlap nor leave a gap.
+ * @param  Points: Pointer to the points array
+ * @param  PointCount: Number of points (up to MAX_POLY_POINTS)
+ * @param  Rule: Fill rule
+ *          This parameter can be one of the following values:
+ *            @arg  EVENODD_RULE
+ *            @arg  NONZERO_RULE
+ */
+void LCD_FillPolygon(pPoint Points, uint16_t PointCount, Fill_RuleTypdef Rule)
+{
+	uint16_t counter = 0, edges = 0, next = 0, active = 0, i = 0, j = 0;
+	int32_t y = 0, yend = 0;
+	int8_t winding = 0;
+	int16_t xstart = 0, xend = 0;
+	PolyEdgeTypeDef edge;
+
+	if(PointCount < 3 || PointCount > MAX_POLY_POINTS)
+	{
+		return;
+	}
+
+	/* Build the edge table, skipping horizontal edges, sorted by YMin */
+	for(counter = 0; counter < PointCount; counter++)
+	{
+		uint16_t n = (counter + 1 == PointCount) ? 0 : counter + 1;
+		int32_t x0 = POLY_X(counter), y0 = POLY_Y(counter);
+		int32_t x1 = POLY_X(n), y1 = POLY_Y(n);
+
+		if(y0 == y1)
+		{
+			continue;
+		}
+
+		edge.Dir = 1;
+		if(y0 > y1)
+		{
+			edge.Dir = -1;
+			x0 = POLY_X(n); y0 = POLY_Y(n);
+			x1 = POLY_X(counter); y1 = POLY_Y(counter);
+		}
+
+		edge.Slope = (int32_t)(((int64_t)(x1 - x0) * 65536) / (y1 - y0));
+		edge.X = x0 * 65536 + edge.Slope / 2;
+		edge.YMin = y0;
+		edge.YMax = y1;
+
+		for(i = edges; i > 0 && polyEdges[i - 1].YMin > edge.YMin; i--)
+		{
+			polyEdges[i] = polyEdges[i - 1];
+		}
+		polyEdges[i] = edge;
+		edges++;
+	}
+
+	if(edges == 0)
+	{
+		return;
+	}
+
+	y = polyEdges[0].YMin < CLIP_TOP ? CLIP_TOP : polyEdges[0].YMin;
+	yend = CLIP_BOTTOM;
+
+	for(; y < yend && (next < edges || active > 0); y++)
+	{
+		/* Drop finished edges */
+		for(i = 0, j = 0; i < active; i++)
+		{
+			if(polyEdges[polyActive[i]].YMax > y)
+			{
+				polyActive[j++] = polyActive[i];
+			}
+		}
+		active = j;
+
+		/* Activate edges starting at this scanline (or above the screen) */
+		while(next < edges && polyEdges[next].YMin <= y)
+		{
+			if(polyEdges[next].YMax > y)
+			{
+				polyEdges[next].X += polyEdges[next].Slope * (y - polyEdges[next].YMin);
+				polyActive[active++] = next;
+			}
+			next++;
+		}
+
+		/* Keep the active list sorted by X, it is almost sorted already */
+		for(i = 1; i < active; i++)
+		{
+			uint8_t index = polyActive[i];
+			for(j = i; j > 0 && polyEdges[polyActive[j - 1]].X > polyEdges[index].X; j--)
+			{
+				polyActive[j] = polyActive[j - 1];
+			}
+			polyActive[j] = index;
+		}
+
+		/* Emit spans */
+		winding = 0;
+		for(i = 0; i < active; i++)
+		{
+			PolyEdgeTypeDef *pEdge = &polyEdges[polyActive[i]];
+
+			if(winding == 0)
+			{
+				xstart = SPAN_START(pEdge->X);
+			}
+
+			winding = (Rule == NONZERO_RULE) ? winding + pEdge->Dir : !winding;
+
+			if(winding == 0)
+			{
+				xend = SPAN_START(pEdge->X);
+				if(xend > xstart)
+				{
+					LCD_DrawHLine(xstart, y, xend - xstart);
+				}
+			}
+
+			pEdge->X += pEdge->Slope;
+		}
+	}
+}
+
+/**
+ * @brief  Draws a full triangle.
+ *         Uses the same pixel center rule as LCD_FillPolygon.
+ * @param  x1: Point 1 X position
+ * @param  y1: Point 1 Y position
+ * @param  x2: Point 2 X position
+ * @param  y2: Point 2 Y position
+ * @param  x3: Point 3 X position
+ * @param  y3: Point 3 Y position
+ */
+void LCD_FillTriangle(int16_t x1, int16_t y1, int16_t x2, int16_t y2, int16_t x3, int16_t y3)
+{
+	int32_t xa = 0, xb = 0, sa = 0, sb = 0, s1 = 0, y = 0, yend = 0;
+	int16_t tmp = 0, xstart = 0, xend = 0;
+
+	/* Sort the vertices by Y */
+	if(y1 > y2) { tmp = y1; y1 = y2; y2 = tmp; tmp = x1; x1 = x2; x2 = tmp; }
+	if(y2 > y3) { tmp = y2; y2 = y3; y3 = tmp; tmp = x2; x2 = x3; x3 = tmp; }
+	if(y1 > y2) { tmp = y1; y1 = y2; y2 = tmp; tmp = x1; x1 = x2; x2 = tmp; }
+
+	if(y1 == y3)
+	{
+		return;
+	}
+
+	/* Long edge 1-3 and the upper short edge 1-2 */
+	sa = (int32_t)(((int64_t)(x3 - x1) * 65536) / (y3 - y1));
+	xa = ((int32_t)x1 * 65536) + sa / 2;
+
+	if(y1 == y2)
+	{
+		sb = (int32_t)(((int64_t)(x3 - x2) * 65536) / (y3 - y2));
+		xb = ((int32_t)x2 * 65536) + sb / 2;
+	}
+	else
+	{
+		sb = (int32_t)(((int64_t)(x2 - x1) * 65536) / (y2 - y1));
+		xb = ((int32_t)x1 * 65536) + sb / 2;
+	}
+
+	s1 = (y2 > y1 && y3 > y2) ? (int32_t)(((int64_t)(x3 - x2) * 65536) / (y3 - y2)) : 0;
+
+	yend = y3 < CLIP_BOTTOM ? y3 : CLIP_BOTTOM;
+
+	for(y = y1; y < yend; y++)
+	{
+		if(y == y2 && y1 != y2)
+		{
+			/* Switch to the lower short edge 2-3 */
+			sb = s1;
+			xb = ((int32_t)x2 * 65536) + sb / 2;
+		}
+
+		if(y >= CLIP_TOP)
+		{
+			xstart = SPAN_START(xa < xb ? xa : xb);
+			xend = SPAN_START(xa < xb ? xb : xa);
+			if(xend > xstart)
+			{
+				LCD_DrawHLine(xstart, y, xend - xstart);
+			}
+		}
+
+		xa += sa;
+		xb += sb;
+	}
+}
+
+/**
+ * @brief  Integer division rounding towards minus infinity.
+ */
+static int32_t FloorDiv(int32_t a, int32_t b)
+{
+	int32_t q = a / b;
+
+	if((a % b != 0) && ((a < 0) != (b < 0)))
+	{
+		q--;
+	}
+	return q;
+}
+
+/**
+ * @brief  Integer division rounding towards plus infinity.
+ */
+static int32_t CeilDiv(int32_t a, int32_t b)
+{
+	return -FloorDiv(-a, b);
+}
+
+/**
+ * @brief  Integer division of a 64 bit dividend rounding towards minus infinity.
+ *         The quotient is limited to +-65536, past any clip seen from an int16_t point.
+ */
+static int32_t FloorDiv64(int64_t a, int32_t b)
+{
+	int64_t q = a / b;
+
+	if((a % b != 0) && ((a < 0) != (b < 0)))
+	{
+		q--;
+	}
+	if(q > 0x10000) q = 0x10000;
+	if(q < -0x10000) q = -0x10000;
+	return (int32_t)q;
+}
+
+/**
+ * @brief  Integer division of a 64 bit dividend rounding towards plus infinity,
+ *         limited as FloorDiv64().
+ */
+static int32_t CeilDiv64(int64_t a, int32_t b)
+{
+	return -FloorDiv64(-a, b);
+}
+
+/**
+ * @brief  Integer square root.
+ * @retval floor(sqrt(n))
+ */
+static uint32_t ISqrt(uint64_t n)
+{
+	uint64_t root = 0, bit = 1ULL << 62;
+
+	while(bit > n)
+	{
+		bit >>= 2;
+	}
+
+	while(bit != 0)
+	{
+		if(n >= root + bit)
+		{
+			n -= root + bit;
+			root = (root >> 1) + bit;
+		}
+		else
+		{
+			root >>= 1;
+		}
+		bit >>= 2;
+	}
+	return (uint32_t)root;
+}
+
+/**
+ * @brief  Gets sine and cosine of an angle.
+ * @param  Angle: Angle in degrees, clockwise on screen from the 3 o'clock direction
+ * @param  pSin: Sine in Q14
+ * @param  pCos: Cosine in Q14
+ */
+static void SinCos(int32_t Angle, int32_t *pSin, int32_t *pCos)
+{
+	Angle %= 360;
+	if(Angle < 0)
+	{
+		Angle += 360;
+	}
+
+	if(Angle <= 90)       { *pSin =  sinTable[Angle];       *pCos =  sinTable[90 - Angle]; }
+	else if(Angle <= 180) { *pSin =  sinTable[180 - Angle]; *pCos = -sinTable[Angle - 90]; }
+	else if(Angle <= 270) { *pSin = -sinTable[Angle - 180]; *pCos = -sinTable[270 - Angle]; }
+	else                  { *pSin = -sinTable[360 - Angle]; *pCos =  sinTable[Angle - 270]; }
+}
+
+/**
+ * @brief  Half-width of a circle scanline.
+ * @param  RR: Radius * (Radius + 1)
+ * @param  Dist: Distance of the scanline from the center
+ * @param  Guess: Half-width of a neighbouring scanline, makes the search O(1)
+ * @retval floor(sqrt(RR - Dist^2)), -1 when the scanline misses the circle
+ */
+static int32_t CircleExtent(int32_t RR, int32_t Dist, int32_t Guess)
+{
+	int32_t t = RR - Dist * Dist;
+
+	if(t < 0)
+	{
+		return -1;
+	}
+
+	if(Guess < 0)
+	{
+		Guess = 0;
+	}
+	while(Guess * Guess > t)
+	{
+		Guess--;
+	}
+	while((Guess + 1) * (Guess + 1) <= t)
+	{
+		Guess++;
+	}
+	return Guess;
+}
+
+/**
+ * @brief  Fills a span, the shared output of the span based primitives.
+ * @param  x1: First X position
+ * @param  x2: Last X position (inclusive)
+ * @param  y: Y position
+ */
+static void FillSpan(int32_t x1, int32_t x2, int32_t y)
+{
+	if(y < CLIP_TOP || y >= CLIP_BOTTOM)
+	{
+		return;
+	}
+
+	if(x1 < CLIP_LEFT) x1 = CLIP_LEFT;
+	if(x2 >= CLIP_RIGHT) x2 = CLIP_RIGHT - 1;
+
+	if(x2 >= x1)
+	{
+		lcd_drv->DrawHLine(x1, y, x2 - x1 + 1, DrawProp.TextColor);
+	}
+}
+
+/**
+ * @brief  Fills the part of a scanline inside a circle sector.
+ * @param  x1: First X offset from the center
+ * @param  x2: Last X offset from the center (inclusive)
+ * @param  dy: Y offset of the scanline from the center
+ * @param  pSector: Sector start/end sine and cosine in Q14 and its sweep in degrees,
+ *                  NULL for the whole circle
+ */
+static void FillSectorSpan(int32_t Xpos, int32_t Ypos, int32_t x1, int32_t x2, int32_t dy, const int32_t *pSector)
+{
+	int32_t loA = x1, hiA = x2, loB = x1, hiB = x2, bound = 0;
+	uint8_t inA = 1, inB = 1;
+
+	if(pSector == NULL)
+	{
+		FillSpan(Xpos + x1, Xpos + x2, Ypos + dy);
+		return;
+	}
+
+	/* Start half-plane: cross(start, P) >= 0 <=> sin*dx <= cos*dy */
+	if(pSector[0] > 0)      { bound = FloorDiv(pSector[1] * dy, pSector[0]); if(bound < hiA) hiA = bound; }
+	else if(pSector[0] < 0) { bound = CeilDiv(pSector[1] * dy, pSector[0]);  if(bound > loA) loA = bound; }
+	else                    { inA = (pSector[1] * dy >= 0); }
+
+	/* End half-plane: cross(P, end) >= 0 <=> sin*dx >= cos*dy */
+	if(pSector[2] > 0)      { bound = CeilDiv(pSector[3] * dy, pSector[2]);  if(bound > loB) loB = bound; }
+	else if(pSector[2] < 0) { bound = FloorDiv(pSector[3] * dy, pSector[2]); if(bound < hiB) hiB = bound; }
+	else                    { inB = (pSector[3] * dy <= 0); }
+
+	inA = inA && (loA <= hiA);
+	inB = inB && (loB <= hiB);
+
+	if(pSector[4] <= 180)
+	{
+		/* Convex sector: inside both half-planes */
+		if(inA && inB)
+		{
+			FillSpan(Xpos + (loA > loB ? loA : loB), Xpos + (hiA < hiB ? hiA : hiB), Ypos + dy);
+		}
+	}
+	else if(inA && inB && loB <= hiA + 1 && loA <= hiB + 1)
+	{
+		/* Reflex sector: inside either half-plane, here the two parts touch */
+		FillSpan(Xpos + (loA < loB ? loA : loB), Xpos + (hiA > hiB ? hiA : hiB), Ypos + dy);
+	}
+	else
+	{
+		if(inA && (!inB || loA < loB))
+		{
+			FillSpan(Xpos + loA, Xpos + hiA, Ypos + dy);
+		}
+		if(inB)
+		{
+			FillSpan(Xpos + loB, Xpos + hiB, Ypos + dy);
+		}
+		if(inA && inB && loA >= loB)
+		{
+			FillSpan(Xpos + loA, Xpos + hiA, Ypos + dy);
+		}
+	}
+}
+
+/**
+ * @brief  Fills a circle sector or its one pixel outline, one pass over the scanlines.
+ * @param  Xpos: X position
+ * @param  Ypos: Y position
+ * @param  Radius: Circle radius
+ * @param  StartAngle: Start angle in degrees, clockwise on screen from 3 o'clock
+ * @param  EndAngle: End angle in degrees
+ * @param  Outline: 1 to draw only the outline arc
+ */
+static void FillCircleSector(int16_t Xpos, int16_t Ypos, uint16_t Radius, int16_t StartAngle, int16_t EndAngle, uint8_t Outline)
+{
+	int32_t sector[5], *pSector = sector;
+	int32_t rr = (int32_t)Radius * (Radius + 1);
+	int32_t dy = 0, k = 0, e = 0, en = 0, inner = 0;
+
+	if(CLIP_OUT(Xpos - Radius, Ypos - Radius, 2 * Radius + 1, 2 * Radius + 1))
+	{
+		return;
+	}
+
+	/* sector[] = start sin, start cos, end sin, end cos, sweep */
+	sector[4] = (int32_t)EndAngle - StartAngle;
+	if(sector[4] >= 360 || sector[4] <= -360)
+	{
+		pSector = NULL;
+	}
+	else
+	{
+		sector[4] = (sector[4] + 360) % 360;
+		if(sector[4] == 0)
+		{
+			return;
+		}
+		SinCos(StartAngle, &sector[0], &sector[1]);
+		SinCos(EndAngle, &sector[2], &sector[3]);
+	}
+
+	for(dy = -Radius; dy <= Radius; dy++)
+	{
+		k = ABS(dy);
+		e = CircleExtent(rr, k, e);
+
+		if(Outline && k < Radius)
+		{
+			/* Connect to the scanline one step further from the center */
+			en = CircleExtent(rr, k + 1, e);
+			inner = (en + 1 < e) ? en + 1 : e;
+		}
+		else
+		{
+			inner = 0;
+		}
+
+		if(inner == 0)
+		{
+			FillSectorSpan(Xpos, Ypos, -e, e, dy, pSector);
+		}
+		else
+		{
+			FillSectorSpan(Xpos, Ypos, -e, -inner, dy, pSector);
+			FillSectorSpan(Xpos, Ypos, inner, e, dy, pSector);
+		}
+	}
+}
+
+/**
+ * @brief  Draws a rounded rectangle.
+ * @param  Xpos: X position
+ * @param  Ypos: Y position
+ * @param  Width: Rectangle width
+ * @param  Height: Rectangle height
+ * @param  Radius: Corner radius
+ */
+void LCD_DrawRoundRect(int16_t Xpos, int16_t Ypos, uint16_t Width, uint16_t Height, uint16_t Radius)
+{
+	int32_t left = 0, right = 0, top = 0, bottom = 0, rr = 0;
+	int32_t y = 0, k = 0, e = 0, en = 0, inner = 0;
+
+	if(Width == 0 || Height == 0)
+	{
+		return;
+	}
+
+	if(Radius > (Width - 1) / 2)  Radius = (Width - 1) / 2;
+	if(Radius > (Height - 1) / 2) Radius = (Height - 1) / 2;
+
+	/* Corner centers */
+	left = Xpos + Radius;
+	right = Xpos + Width - 1 - Radius;
+	top = Ypos + Radius;
+	bottom = Ypos + Height - 1 - Radius;
+	rr = (int32_t)Radius * (Radius + 1);
+
+	for(y = Ypos; y < Ypos + Height; y++)
+	{
+		k = (y < top) ? top - y : (y > bottom) ? y - bottom : 0;
+		e = CircleExtent(rr, k, e);
+
+		if(y == Ypos || y == Ypos + Height - 1)
+		{
+			FillSpan(left - e, right + e, y);
+		}
+		else if(k > 0)
+		{
+			en = CircleExtent(rr, k + 1, e);
+			inner = (en + 1 < e) ? en + 1 : e;
+
+			FillSpan(left - e, left - inner, y);
+			FillSpan(right + inner, right + e, y);
+		}
+		else
+		{
+			/* Straight sides are drawn column wise below */
+			y = bottom < Ypos + Height - 2 ? bottom : Ypos + Height - 2;
+		}
+	}
+
+	top = top > Ypos + 1 ? top : Ypos + 1;
+	bottom = bottom < Ypos + Height - 2 ? bottom : Ypos + Height - 2;
+	if(bottom >= top)
+	{
+		LCD_DrawVLine(Xpos, top, bottom - top + 1);
+		LCD_DrawVLine(Xpos + Width - 1, top, bottom - top + 1);
+	}
+}
+
+/**
+ * @brief  Draws a full rounded rectangle.
+ * @param  Xpos: X position
+ * @param  Ypos: Y position
+ * @param  Width: Rectangle width
+ * @param  Height: Rectangle height
+ * @param  Radius: Corner radius
+ */
+void LCD_FillRoundRect(int16_t Xpos, int16_t Ypos, uint16_t Width, uint16_t Height, uint16_t Radius)
+{
+	int32_t left = 0, right = 0, top = 0, bottom = 0, rr = 0;
+	int32_t y = 0, k = 0, e = 0;
+
+	if(Width == 0 || Height == 0)
+	{
+		return;
+	}
+
+	if(Radius > (Width - 1) / 2)  Radius = (Width - 1) / 2;
+	if(Radius > (Height - 1) / 2) Radius = (Height - 1) / 2;
+
+	/* Corner centers */
+	left = Xpos + Radius;
+	right = Xpos + Width - 1 - Radius;
+	top = Ypos + Radius;
+	bottom = Ypos + Height - 1 - Radius;
+	rr = (int32_t)Radius * (Radius + 1);
+
+	for(y = Ypos; y < Ypos + Height; y++)
+	{
+		k = (y < top) ? top - y : (y > bottom) ? y - bottom : 0;
+		e = CircleExtent(rr, k, e);
+
+		FillSpan(left - e, right + e, y);
+	}
+}
+
+/**
+ * @brief  Draws an arc of a circle.
+ * @param  Xpos: X position
+ * @param  Ypos: Y position
+ * @param  Radius: Circle radius
+ * @param  StartAngle: Start angle in degrees, clockwise on screen from 3 o'clock
+ * @param  EndAngle: End angle in degrees, a full circle if 360 or more from StartAngle
+ */
+void LCD_DrawArc(int16_t Xpos, int16_t Ypos, uint16_t Radius, int16_t StartAngle, int16_t EndAngle)
+{
+	FillCircleSector(Xpos, Ypos, Radius, StartAngle, EndAngle, 1);
+}
+
+/**
+ * @brief  Draws a full pie slice.
+ * @param  Xpos: X position
+ * @param  Ypos: Y position
+ * @param  Radius: Circle radius
+ * @param  StartAngle: Start angle in degrees, clockwise on screen from 3 o'clock
+ * @param  EndAngle: End angle in degrees, a full circle if 360 or more from StartAngle
+ */
+void LCD_FillPie(int16_t Xpos, int16_t Ypos, uint16_t Radius, int16_t StartAngle, int16_t EndAngle)
+{
+	FillCircleSector(Xpos, Ypos, Radius, StartAngle, EndAngle, 0);
+}
+
+/**
+ * @brief  Gets the pixels of a scanline within the caps of a thick line.
+ * @param  Ex: End point X position
+ * @param  dy: Scanline Y offset from the end point
+ * @param  Width: Line width
+ * @param  pLo: Extended with the first pixel
+ * @param  pHi: Extended with the last pixel
+ */
+static void RoundCapSpan(int32_t Ex, int32_t dy, int32_t Width, int32_t *pLo, int32_t *pHi)
+{
+	/* Pixels with 4 * distance^2 < Width^2 */
+	int64_t t = (int64_t)Width * Width - 4 * (int64_t)dy * dy;
+	int32_t half = 0;
+
+	if(t > 0)
+	{
+		half = ISqrt(t - 1) >> 1;
+		if(Ex - half < *pLo) *pLo = Ex - half;
+		if(Ex + half > *pHi) *pHi = Ex + half;
+	}
+}
+
+/**
+ * @brief  Draws a thick line (between two points).
+ * @param  x1: Point 1 X position
+ * @param  y1: Point 1 Y position
+ * @param  x2: Point 2 X position
+ * @param  y2: Point 2 Y position
+ * @param  Width: Line width
+ * @param  Cap: Line cap
+ *          This parameter can be one of the following values:
+ *            @arg  BUTT_CAP
+ *            @arg  ROUND_CAP
+ *            @arg  SQUARE_CAP
+ */
+void LCD_DrawThickLine(int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t Width, Line_CapTypdef Cap)
+{
+	/* The Q8 products below overflow 32 bits for far apart int16_t end points */
+	int32_t dx = x2 - x1, dy = y2 - y1;
+	int64_t len2 = (int64_t)dx * dx + (int64_t)dy * dy;
+	int64_t len4 = 0, side = 0, sideHi = 0, projLo = 0, projHi = 0, c = 0;
+	int32_t y = 0, yy = 0, yend = 0, lo = 0, hi = 0;
+
+	if(Width == 0)
+	{
+		return;
+	}
+
+	if(len2 == 0)
+	{
+		/* Degenerated to a point */
+		if(Cap == SQUARE_CAP)
+		{
+			for(y = y1 - Width / 2; y <= y1 + (Width - 1) / 2; y++)
+			{
+				FillSpan(x1 - Width / 2, x1 + (Width - 1) / 2, y);
+			}
+		}
+		else if(Cap == ROUND_CAP)
+		{
+			for(y = y1 - Width / 2; y <= y1 + Width / 2; y++)
+			{
+				lo = INT16_MAX; hi = INT16_MIN;
+				RoundCapSpan(x1, y - y1, Width, &lo, &hi);
+				FillSpan(lo, hi, y);
+			}
+		}
+		return;
+	}
+
+	/* Q8 bounds of the cross product (side of the line, [-w/2, w/2)) and of the
+	 * dot product (position along the line) of a pixel relative to point 1 */
+	len4 = ISqrt(len2 * 256);
+	side = (int64_t)Width * 8 * len4;
+	sideHi = side - len4;
+	projLo = 0;
+	projHi = len2 * 256;
+	if(Cap == SQUARE_CAP)
+	{
+		projLo -= side;
+		projHi += sideHi;
+	}
+
+	y = (y1 < y2 ? y1 : y2) - Width;
+	yend = (y1 > y2 ? y1 : y2) + Width;
+	if(y < CLIP_TOP) y = CLIP_TOP;
+	if(yend >= CLIP_BOTTOM) yend = CLIP_BOTTOM - 1;
+
+	for(; y <= yend; y++)
+	{
+		yy = y - y1;
+		lo = INT16_MAX;
+		hi = INT16_MIN;
+
+		/* 256 * (x - x1) * dy - 256 * yy * dx within [-side, sideHi] */
+		c = (int64_t)256 * yy * dx;
+		if(dy > 0)      { lo = CeilDiv64(c - side, 256 * dy); hi = FloorDiv64(c + sideHi, 256 * dy); }
+		else if(dy < 0) { lo = CeilDiv64(c + sideHi, 256 * dy); hi = FloorDiv64(c - side, 256 * dy); }
+		else if(-c >= -side && -c <= sideHi) { lo = -0x10000; hi = 0x10000; }
+
+		/* 256 * (x - x1) * dx + 256 * yy * dy within [projLo, projHi] */
+		c = (int64_t)256 * yy * dy;
+		if(dx > 0)
+		{
+			if(CeilDiv64(projLo - c, 256 * dx) > lo) lo = CeilDiv64(projLo - c, 256 * dx);
+			if(FloorDiv64(projHi - c, 256 * dx) < hi) hi = FloorDiv64(projHi - c, 256 * dx);
+		}
+		else if(dx < 0)
+		{
+			if(CeilDiv64(projHi - c, 256 * dx) > lo) lo = CeilDiv64(projHi - c, 256 * dx);
+			if(FloorDiv64(projLo - c, 256 * dx) < hi) hi = FloorDiv64(projLo - c, 256 * dx);
+		}
+		else if(c < projLo || c > projHi)
+		{
+			lo = INT16_MAX; hi = INT16_MIN;
+		}
+
+		if(lo > hi)
+		{
+			lo = INT16_MAX; hi = INT16_MIN;
+		}
+		else
+		{
+			lo += x1;
+			hi += x1;
+		}
+
+		/* The capsule is convex, so the caps just widen the span */
+		if(Cap == ROUND_CAP)
+		{
+			RoundCapSpan(x1, yy, Width, &lo, &hi);
+			RoundCapSpan(x2, y - y2, Width, &lo, &hi);
+		}
+
+		FillSpan(lo, hi, y);
+	}
+}
+
+/**
+ * @brief  Streams a run of anti-aliased pixel pairs through one window.
+ *         aaLevels[0] holds the near pixels, aaLevels[1] the far ones.
+ * @param  Xpos: X position of the first near pixel
+ * @param  Ypos: Y position of the first near pixel
+ * @param  Length: Run length along the major axis
+ * @param  Steep: 0 when the run is horizontal (far pixels below),
+ *                1 when it is vertical (far pixels to the right)
+ * @param  pRamp: Blend ramp, used when not reading back
+ */
+static void DrawAARun(int16_t Xpos, int16_t Ypos, uint16_t Length, uint8_t Steep, const uint16_t *pRamp)
+{
+	uint16_t width = Steep ? 2 : Length, height = Steep ? Length : 2;
+	uint16_t i = 0, k = 0, index = 0;
+
+	if(Xpos < CLIP_LEFT || Ypos < CLIP_TOP || Xpos + width > CLIP_RIGHT || Ypos + height > CLIP_BOTTOM)
+	{
+		/* Partially visible runs go pixel by pixel */
+		for(i = 0; i < Length; i++)
+		{
+			DrawAAPixel(Steep ? Xpos : Xpos + i, Steep ? Ypos + i : Ypos, aaLevels[0][i], pRamp);
+			DrawAAPixel(Steep ? Xpos + 1 : Xpos + i, Steep ? Ypos + i : Ypos + 1, aaLevels[1][i], pRamp);
+		}
+		return;
+	}
+
+	LCD_SetDisplayWindow(Xpos, Ypos, width, height);
+
+	if(aaMode == AA_READBACK_MODE)
+	{
+		lcd_drv->ReadRGBImage(Xpos, Ypos, aaPixels, 2 * Length);
+	}
+
+	for(k = 0; k < 2; k++)
+	{
+		for(i = 0; i < Length; i++)
+		{
+			index = Steep ? 2 * i + k : k * Length + i;
+
+			if(aaMode == AA_READBACK_MODE)
+			{
+				aaPixels[index] = BlendRGB565(DrawProp.TextColor, aaPixels[index], AA_ALPHA(aaLevels[k][i]));
+			}
+			else
+			{
+				aaPixels[index] = pRamp[aaLevels[k][i]];
+			}
+		}
+	}
+
+	lcd_drv->DrawRGBImage(Xpos, Ypos, aaPixels, 2 * Length);
+
+	LCD_SetDisplayWindow(0, 0, LCD_GetWidth(), LCD_GetHeight());
+}
+
+/**
+ * @brief  Selects the background anti-aliased shapes are blended against.
+ * @param  Mode: Anti-aliasing mode
+ *          This parameter can be one of the following values:
+ *            @arg  AA_BACKCOLOR_MODE: blend against the LCD background color,
+ *                  the area under the shape is expected to be of that color
+ *            @arg  AA_READBACK_MODE: blend against the current GRAM content
+ */
+void LCD_SetAAMode(AA_ModeTypdef Mode)
+{
+	aaMode = Mode;
+}
+
+/**
+ * @brief  Draws an anti-aliased line (between two points).
+ * @param  x1: Point 1 X position
+ * @param  y1: Point 1 Y position
+ * @param  x2: Point 2 X position
+ * @param  y2: Point 2 Y position
+ */
+void LCD_DrawAALine(int16_t x1, int16_t y1, int16_t x2, int16_t y2)
+{
+	const uint16_t *pRamp = (aaMode == AA_READBACK_MODE) ? NULL : GetAARamp();
+	int16_t tmp = 0, major = 0, minor = 0, start = 0, count = 0;
+	int32_t gradient = 0, inter = 0;
+	uint8_t steep = ABS(y2 - y1) > ABS(x2 - x1);
+	uint8_t level = 0;
+
+	if(steep)
+	{
+		tmp = x1; x1 = y1; y1 = tmp;
+		tmp = x2; x2 = y2; y2 = tmp;
+	}
+
+	if(x1 > x2)
+	{
+		tmp = x1; x1 = x2; x2 = tmp;
+		tmp = y1; y1 = y2; y2 = tmp;
+	}
+
+	/* Minor axis position in 16.16 fixed point, walked along the major axis */
+	gradient = (x2 == x1) ? 0 : (int32_t)(y2 - y1) * 65536 / (x2 - x1);
+	inter = (int32_t)y1 * 65536;
+
+	start = x1;
+	minor = y1;
+
+	for(major = x1; major <= x2; major++)
+	{
+		if((inter >> 16) != minor || count == AA_MAX_RUN)
+		{
+			/* The pixel pair moved to another row (column), flush the run */
+			DrawAARun(steep ? minor : start, steep ? start : minor, count, steep, pRamp);
+			start = major;
+			minor = inter >> 16;
+			count = 0;
+		}
+
+		level = (inter >> (16 - 4)) & 0x0F;
+		aaLevels[0][count] = (AA_LEVELS - 1) - level;
+		aaLevels[1][count] = level;
+		count++;
+
+		inter += gradient;
+	}
+
+	DrawAARun(steep ? minor : start, steep ? start : minor, count, steep, pRamp);
+}
+
+/**
+ * @brief  Draws an anti-aliased circle.
+ * @param  Xpos: X position
+ * @param  Ypos: Y position
+ * @param  Radius: Circle radius
+ */
+void LCD_DrawAACircle(uint16_t Xpos, uint16_t Ypos, uint16_t Radius)
+{
+	const uint16_t *pRamp = (aaMode == AA_READBACK_MODE) ? NULL : GetAARamp();
+	int32_t x = 0, y16 = Radius * 16, target = 0;
+	int16_t y = 0;
+	uint8_t inner = 0, outer = 0;
+
+	if(CLIP_OUT((int32_t)Xpos - Radius - 1, (int32_t)Ypos - Radius - 1, 2 * Radius + 3, 2 * Radius + 3))
+	{
+		return;
+	}
+
+	for(x = 0; ; x++)
+	{
+		/* y16 = floor(16 * sqrt(R^2 - x^2)), walked down incrementally */
+		target = ((int32_t)Radius * Radius - x * x) * 256;
+		while(y16 > 0 && y16 * y16 > target)
+		{
+			y16--;
+		}
+
+		y = y16 >> 4;
+		if(x > y)
+		{
+			break;
+		}
+
+		outer = y16 & 0x0F;
+		inner = (AA_LEVELS - 1) - outer;
+
+		/* Octants below the diagonal, mirrored around both axes */
+		DrawAAPixel(Xpos + x, Ypos - y, inner, pRamp);
+		DrawAAPixel(Xpos + x, Ypos - y - 1, outer, pRamp);
+		DrawAAPixel(Xpos + x, Ypos + y, inner, pRamp);
+		DrawAAPixel(Xpos + x, Ypos + y + 1, outer, pRamp);
+		if(x > 0)
+		{
+			DrawAAPixel(Xpos - x, Ypos - y, inner, pRamp);
+			DrawAAPixel(Xpos - x, Ypos - y - 1, outer, pRamp);
+			DrawAAPixel(Xpos - x, Ypos + y, inner, pRamp);
+			DrawAAPixel(Xpos - x, Ypos + y + 1, outer, pRamp);
+		}
+
+		/* Octants above the diagonal, the diagonal pixel itself is already drawn */
+		if(x < y)
+		{
+			DrawAAPixel(Xpos + y, Ypos - x, inner, pRamp);
+			DrawAAPixel(Xpos - y, Ypos - x, inner, pRamp);
+			if(x > 0)
+			{
+				DrawAAPixel(Xpos + y, Ypos + x, inner, pRamp);
+				DrawAAPixel(Xpos - y, Ypos + x, inner, pRamp);
+			}
+		}
+		DrawAAPixel(Xpos + y + 1, Ypos - x, outer, pRamp);
+		DrawAAPixel(Xpos - y - 1, Ypos - x, outer, pRamp);
+		if(x > 0)
+		{
+			DrawAAPixel(Xpos + y + 1, Ypos + x, outer, pRamp);
+			DrawAAPixel(Xpos - y - 1, Ypos + x, outer, pRamp);
+		}
+	}
+}
+
+/* 4x4 ordered dither thresholds */
+static const uint8_t ditherMatrix[4][4] =
+{
+	{  0,  8,  2, 10 },
+	{ 12,  4, 14,  6 },
+	{  3, 11,  1,  9 },
+	{ 15,  7, 13,  5 }
+};
+
+/**
+ * @brief  Packs 16.16 fixed point color channels rounded up at a threshold.
+ * @param  pChannel: Red, green and blue channels
+ * @param  Threshold: Fraction at which a channel rounds up, 16 bit
+ * @retval RGB565 color
+ */
+static inline uint16_t GradientColor(const int32_t *pChannel, int32_t Threshold)
+{
+	return (((pChannel[0] + Threshold) >> 16) << 11) | (((pChannel[1] + Threshold) >> 16) << 5) | ((pChannel[2] + Threshold) >> 16);
+}
+
+/**
+ * @brief  Draws a full rectangle blending linearly between two colors.
+ * @param  Xpos: X position
+ * @param  Ypos: Y position
+ * @param  Width: Rectangle width
+ * @param  Height: Rectangle height
+ * @param  Color0: Color of the first column or row
+ * @param  Color1: Color of the last column or row
+ * @param  Mode: Gradient mode
+ *          This parameter can be one of the following values:
+ *            @arg  HORIZONTAL_GRADIENT
+ *            @arg  VERTICAL_GRADIENT
+ *          optionally OR'ed with DITHER_GRADIENT
+ */
+void LCD_FillGradient(int16_t Xpos, int16_t Ypos, uint16_t Width, uint16_t Height, uint16_t Color0, uint16_t Color1, uint8_t Mode)
+{
+	uint16_t pixels[GRADIENT_RUN];
+	int32_t start[3], step[3], channel[3];
+	int32_t x1 = Xpos, y1 = Ypos, x2 = Xpos + Width, y2 = Ypos + Height;
+	int32_t x = 0, y = 0, length = 0, run = 0, i = 0, k = 0;
+	uint16_t color = 0, runColor = 0;
+	uint32_t runLength = 0;
+
+	if(x1 < CLIP_LEFT) x1 = CLIP_LEFT;
+	if(y1 < CLIP_TOP) y1 = CLIP_TOP;
+	if(x2 > CLIP_RIGHT) x2 = CLIP_RIGHT;
+	if(y2 > CLIP_BOTTOM) y2 = CLIP_BOTTOM;
+
+	if(x2 <= x1 || y2 <= y1)
+	{
+		return;
+	}
+
+	/* Channels in 16.16 fixed point, stepped once per pixel along the gradient */
+	length = (Mode & VERTICAL_GRADIENT) ? Height : Width;
+
+	start[0] = (Color0 >> 11) * 65536;
+	start[1] = ((Color0 >> 5) & 0x3F) * 65536;
+	start[2] = (Color0 & 0x1F) * 65536;
+	step[0] = (Color1 >> 11) * 65536 - start[0];
+	step[1] = ((Color1 >> 5) & 0x3F) * 65536 - start[1];
+	step[2] = (Color1 & 0x1F) * 65536 - start[2];
+
+	for(k = 0; k < 3; k++)
+	{
+		step[k] = length > 1 ? (step[k] + (step[k] < 0 ? -(length - 1) : length - 1) / 2) / (length - 1) : 0;
+	}
+
+	/* The whole visible area is one window streamed row by row */
+	LCD_SetDisplayWindow(x1, y1, x2 - x1, y2 - y1);
+	lcd_drv->SetCursor(x1, y1);
+
+	for(y = y1; y < y2; y++)
+	{
+		for(k = 0; k < 3; k++)
+		{
+			channel[k] = start[k] + step[k] * ((Mode & VERTICAL_GRADIENT) ? y - Ypos : x1 - Xpos);
+		}
+
+		if(Mode == VERTICAL_GRADIENT)
+		{
+			/* Rows of one color, consecutive equal rows are written at once */
+			color = GradientColor(channel, 0x8000);
+			if(runLength > 0 && color != runColor)
+			{
+				lcd_drv->FillGRAM(runColor, runLength);
+				runLength = 0;
+			}
+			runColor = color;
+			runLength += x2 - x1;
+			continue;
+		}
+
+		for(x = x1; x < x2; x += run)
+		{
+			run = (x2 - x < GRADIENT_RUN) ? x2 - x : GRADIENT_RUN;
+
+			for(i = 0; i < run; i++)
+			{
+				pixels[i] = GradientColor(channel, (Mode & DITHER_GRADIENT) ? ditherMatrix[y & 3][(x + i) & 3] * 4096 + 2048 : 0x8000);
+
+				if(!(Mode & VERTICAL_GRADIENT))
+				{
+					channel[0] += step[0];
+					channel[1] += step[1];
+					channel[2] += step[2];
+				}
+			}
+
+			lcd_drv->WriteGRAM(pixels, run);
+		}
+	}
+
+	if(runLength > 0)
+	{
+		lcd_drv->FillGRAM(runColor, runLength);
+	}
+
+	LCD_SetDisplayWindow(0, 0, LCD_GetWidth(), LCD_GetHeight());
+}
+
+#if BAND_BUFFER_SIZE > 0
+/**
+ * @brief  Turns a position of the band driver rotation into the scene rotation.
+ * @param  pXpos: X position, replaced by the scene X position
+ * @param  pYpos: Y position, replaced by the scene Y position
+ */
+static void BandToScene(int32_t *pXpos, int32_t *pYpos)
+{
+	int32_t x = *pXpos, y = *pYpos;
+
+	/* Turned by LCD_DisplayStringVertical(), a quarter turn at a time */
+	switch((band.Turn - band.Rotation) & 3)
+	{
+	case 1:
+		*pXpos = y;
+		*pYpos = band.ScreenHeight - 1 - x;
+		break;
+	case 2:
+		*pXpos = band.ScreenWidth - 1 - x;
+		*pYpos = band.ScreenHeight - 1 - y;
+		break;
+	case 3:
+		*pXpos = band.ScreenWidth - 1 - y;
+		*pYpos = x;
+		break;
+	default:
+		break;
+	}
+}
+
+/**
+ * @brief  Turns a position of the scene rotation into the band driver rotation.
+ * @param  pXpos: X position, replaced by the turned X position
+ * @param  pYpos: Y position, replaced by the turned Y position
+ */
+static void BandFromScene(int32_t *pXpos, int32_t *pYpos)
+{
+	int32_t x = *pXpos, y = *pYpos;
+
+	switch((band.Turn - band.Rotation) & 3)
+	{
+	case 1:
+		*pXpos = band.ScreenHeight - 1 - y;
+		*pYpos = x;
+		break;
+	case 2:
+		*pXpos = band.ScreenWidth - 1 - x;
+		*pYpos = band.ScreenHeight - 1 - y;
+		break;
+	case 3:
+		*pXpos = y;
+		*pYpos = band.ScreenWidth - 1 - x;
+		break;
+	default:
+		break;
+	}
+}
+
+/**
+ * @brief  Finds a pixel of the scene band.
+ * @param  Xpos: X position in the rotation the band driver is set to
+ * @param  Ypos: Y position in the rotation the band driver is set to
+ * @retval Pointer to the pixel, NULL if it is outside of the band
+ */
+static uint16_t *BandPixel(int32_t Xpos, int32_t Ypos)
+{
+	int32_t x = Xpos, y = Ypos;
+
+	BandToScene(&x, &y);
+
+	x -= band.Area.X;
+	y -= band.Area.Y;
+
+	if(x < 0 || y < 0 || x >= band.Area.Width || y >= band.Area.Height)
+	{
+		return NULL;
+	}
+
+	return &bandPixels[y * band.Area.Width + x];
+}
+
+/**
+ * @brief  Gets the pixel at the address counter of the band driver and moves the counter.
+ * @retval Pointer to the pixel, NULL if it is outside of the band
+ */
+static uint16_t *BandNext(void)
+{
+	uint16_t *pPixel = BandPixel(band.CurX, band.CurY);
+
+	/* Row by row inside the window, like the GRAM address counter */
+	if(++band.CurX > band.WinX2)
+	{
+		band.CurX = band.WinX1;
+
+		if(++band.CurY > band.WinY2)
+		{
+			band.CurY = band.WinY1;
+		}
+	}
+
+	return pPixel;
+}
+
+static uint16_t Band_GetLcdPixelWidth(void)
+{
+	return ((band.Turn - band.Rotation) & 1) ? band.ScreenHeight : band.ScreenWidth;
+}
+
+static uint16_t Band_GetLcdPixelHeight(void)
+{
+	return ((band.Turn - band.Rotation) & 1) ? band.ScreenWidth : band.ScreenHeight;
+}
+
+static void Band_Clear(uint16_t RGBCode)
+{
+	uint32_t i = 0;
+
+	for(i = 0; i < (uint32_t)band.Area.Width * band.Area.Height; i++)
+	{
+		bandPixels[i] = RGBCode;
+	}
+}
+
+static void Band_SetRotation(uint8_t rotation)
+{
+	int32_t x1 = band.WinX1, y1 = band.WinY1, x2 = band.WinX2, y2 = band.WinY2;
+
+	/* Like the window registers, the window stays on the same screen pixels */
+	BandToScene(&x1, &y1);
+	BandToScene(&x2, &y2);
+
+	band.Turn = rotation % 4;
+
+	BandFromScene(&x1, &y1);
+	BandFromScene(&x2, &y2);
+
+	band.WinX1 = x1 < x2 ? x1 : x2;
+	band.WinY1 = y1 < y2 ? y1 : y2;
+	band.WinX2 = x1 < x2 ? x2 : x1;
+	band.WinY2 = y1 < y2 ? y2 : y1;
+}
+
+static void Band_SetCursor(uint16_t Xpos, uint16_t Ypos)
+{
+	if(Xpos >= Band_GetLcdPixelWidth() || Ypos >= Band_GetLcdPixelHeight())
+		return;
+
+	band.CurX = Xpos;
+	band.CurY = Ypos;
+}
+
+static void Band_SetDisplayWindow(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height)
+{
+	if(Xpos >= Band_GetLcdPixelWidth() || Ypos >= Band_GetLcdPixelHeight())
+		return;
+
+	/* Windows running off the screen are cut at its edge */
+	if(Xpos + Width > Band_GetLcdPixelWidth())
+		Width = Band_GetLcdPixelWidth() - Xpos;
+	if(Ypos + Height > Band_GetLcdPixelHeight())
+		Height = Band_GetLcdPixelHeight() - Ypos;
+
+	band.WinX1 = Xpos;
+	band.WinY1 = Ypos;
+	band.WinX2 = Xpos + Width - 1;
+	band.WinY2 = Ypos + Height - 1;
+}
+
+static void Band_WritePixel(uint16_t Xpos, uint16_t Ypos, uint16_t RGBCode)
+{
+	uint16_t *pPixel = BandPixel(Xpos, Ypos);
+
+	if(pPixel != NULL)
+	{
+		*pPixel = RGBCode;
+	}
+}
+
+static uint16_t Band_ReadPixel(uint16_t Xpos, uint16_t Ypos)
+{
+	uint16_t *pPixel = BandPixel(Xpos, Ypos);
+
+	return pPixel != NULL ? *pPixel : 0;
+}
+
+static void Band_DrawHLine(int16_t Xpos, int16_t Ypos, uint16_t Length, uint16_t RGBCode)
+{
+	int32_t x = 0;
+
+	for(x = Xpos; x < Xpos + Length; x++)
+	{
+		Band_WritePixel(x, Ypos, RGBCode);
+	}
+}
+
+static void Band_DrawVLine(int16_t Xpos, int16_t Ypos, uint16_t Length, uint16_t RGBCode)
+{
+	int32_t y = 0;
+
+	for(y = Ypos; y < Ypos + Length; y++)
+	{
+		Band_WritePixel(Xpos, y, RGBCode);
+	}
+}
+
+static void Band_WriteGRAM(uint16_t *pdata, uint32_t Size)
+{
+	uint16_t *pPixel = NULL;
+
+	while(Size-- > 0)
+	{
+		pPixel = BandNext();
+
+		if(pPixel != NULL)
+		{
+			*pPixel = *pdata;
+		}
+		pdata++;
+	}
+}
+
+static void Band_FillGRAM(uint16_t RGBCode, uint32_t Size)
+{
+	uint16_t *pPixel = NULL;
+
+	while(Size-- > 0)
+	{
+		pPixel = BandNext();
+
+		if(pPixel != NULL)
+		{
+			*pPixel = RGBCode;
+		}
+	}
+}
+
+static void Band_DrawRGBImage(uint16_t Xpos, uint16_t Ypos, uint16_t *pdata, uint32_t Size)
+{
+	Band_SetCursor(Xpos, Ypos);
+	Band_WriteGRAM(pdata, Size);
+}
+
+static void Band_DrawBitmap(uint16_t Xpos, uint16_t Ypos, uint8_t *pbmp)
+{
+	uint32_t index = 0, size = 0;
+
+	/* Same header reading as the display driver */
+	size = *(uint16_t *) (pbmp + 2);
+	size |= (*(uint16_t *) (pbmp + 4)) << 16;
+	index = *(uint16_t *) (pbmp + 10);
+	index |= (*(uint16_t *) (pbmp + 12)) << 16;
+
+	Band_DrawRGBImage(Xpos, Ypos, (uint16_t *)(pbmp + index), (size - index) / 2);
+}
+
+static void Band_ReadRGBImage(uint16_t Xpos, uint16_t Ypos, uint16_t *pdata, uint32_t Size)
+{
+	uint16_t *pPixel = NULL;
+
+	Band_SetCursor(Xpos, Ypos);
+
+	while(Size-- > 0)
+	{
+		pPixel = BandNext();
+		*pdata++ = pPixel != NULL ? *pPixel : 0;
+	}
+}
+
+static void Band_WriteRowPixels(uint16_t Ypos, uint16_t *pXpos, uint16_t Count, uint16_t RGBCode)
+{
+	while(Count-- > 0)
+	{
+		Band_WritePixel(*pXpos++, Ypos, RGBCode);
+	}
+}
+#endif
+
+/**
+ * @brief  Draws a scene band by band: each band is rendered into RAM, overdraw
+ *         included, then sent to the display in one burst. The scene is drawn
+ *         over the back color, with the colors, font and text settings
+ *         current at the call, and must not change the rotation. Pixels read
+ *         back by the scene are only valid inside the band. Without a band
+ *         buffer the scene is drawn straight to the display.
+ * @param  pArea: Part of the screen to draw, NULL for the whole screen
+ * @param  Scene: Function drawing the scene with the LCD functions, called once per band
+ * @retval LCD_OK, or LCD_ERROR if a scene is already being drawn, the clip stack is
+ *         full or a row of the area does not fit in BAND_BUFFER_SIZE pixels
+ */
+uint8_t LCD_DrawScene(const Rect *pArea, void (*Scene)(void))
+{
+#if BAND_BUFFER_SIZE > 0
+	LCD_DrawPropTypeDef prop = DrawProp;
+	Text_ModeTypdef mode = textMode;
+	AA_ModeTypdef aa = aaMode;
+	uint8_t scale = textScale, depth = clipDepth;
+	int32_t x1 = CLIP_LEFT, y1 = CLIP_TOP, x2 = CLIP_RIGHT, y2 = CLIP_BOTTOM, y = 0, rows = 0;
+
+	if(lcd_drv == &bandDrv || clipDepth >= MAX_CLIP_DEPTH)
+	{
+		return LCD_ERROR;
+	}
+
+	/* Nothing outside of the clip rectangle is sent */
+	if(pArea != NULL)
+	{
+		if(pArea->X > x1) x1 = pArea->X;
+		if(pArea->Y > y1) y1 = pArea->Y;
+		if(pArea->X + pArea->Width < x2) x2 = pArea->X + pArea->Width;
+		if(pArea->Y + pArea->Height < y2) y2 = pArea->Y + pArea->Height;
+	}
+
+	if(x2 <= x1 || y2 <= y1)
+	{
+		return LCD_OK;
+	}
+
+	if(x2 - x1 > BAND_BUFFER_SIZE)
+	{
+		return LCD_ERROR;
+	}
+
+	band.pTarget = lcd_drv;
+	band.ScreenWidth = LCD_GetWidth();
+	band.ScreenHeight = LCD_GetHeight();
+	band.Rotation = lcdRotation;
+	band.Turn = lcdRotation;
+	band.Area.X = x1;
+	band.Area.Width = x2 - x1;
+
+	/* The band driver only replaces the drawing functions */
+	bandDrv = *lcd_drv;
+	bandDrv.GetLcdPixelWidth = Band_GetLcdPixelWidth;
+	bandDrv.GetLcdPixelHeight = Band_GetLcdPixelHeight;
+	bandDrv.Clear = Band_Clear;
+	bandDrv.SetRotation = Band_SetRotation;
+	bandDrv.SetCursor = Band_SetCursor;
+	bandDrv.SetDisplayWindow = Band_SetDisplayWindow;
+	bandDrv.WritePixel = Band_WritePixel;
+	bandDrv.ReadPixel = Band_ReadPixel;
+	bandDrv.DrawHLine = Band_DrawHLine;
+	bandDrv.DrawVLine = Band_DrawVLine;
+	bandDrv.DrawBitmap = Band_DrawBitmap;
+	bandDrv.DrawRGBImage = Band_DrawRGBImage;
+	bandDrv.ReadRGBImage = Band_ReadRGBImage;
+	bandDrv.WriteGRAM = Band_WriteGRAM;
+	bandDrv.FillGRAM = Band_FillGRAM;
+	bandDrv.WriteRowPixels = Band_WriteRowPixels;
+
+	rows = BAND_BUFFER_SIZE / band.Area.Width;
+
+	for(y = y1; y < y2; y += rows)
+	{
+		band.Area.Y = y;
+		band.Area.Height = y2 - y < rows ? y2 - y : rows;
+
+		lcd_drv = &bandDrv;
+		Band_SetDisplayWindow(0, 0, band.ScreenWidth, band.ScreenHeight);
+		Band_Clear(prop.BackColor);
+
+		/* Every band starts from the same settings, clipped to the band */
+		DrawProp = prop;
+		textMode = mode;
+		textScale = scale;
+		aaMode = aa;
+		LCD_PushClip(band.Area.X, band.Area.Y, band.Area.Width, band.Area.Height);
+
+		Scene();
+
+		clipDepth = depth + 1;
+		LCD_PopClip();
+		lcd_drv = band.pTarget;
+
+		lcd_drv->SetDisplayWindow(band.Area.X, band.Area.Y, band.Area.Width, band.Area.Height);
+		lcd_drv->SetCursor(band.Area.X, band.Area.Y);
+		lcd_drv->WriteGRAM(bandPixels, band.Area.Width * band.Area.Height);
+	}
+
+	lcd_drv->SetDisplayWindow(0, 0, band.ScreenWidth, band.ScreenHeight);
+
+	DrawProp = prop;
+	textMode = mode;
+	textScale = scale;
+	aaMode = aa;
+#else
+	if(pArea != NULL)
+	{
+		if(LCD_PushClip(pArea->X, pArea->Y, pArea->Width, pArea->Height) != LCD_OK)
+		{
+			return LCD_ERROR;
+		}
+	}
+
+	Scene();
+
+	if(pArea != NULL)
+	{
+		LCD_PopClip();
+	}
+#endif
+
+	return LCD_OK;
 }
 
 /**
- * @brief  Draws a rectangle.
- * @param  Xpos: X position
- * @param  Ypos: Y position
- * @param  Width: Rectangle width
- * @param  Height: Rectangle height
+ * @brief  Gets how much more merging two regions costs than flushing them apart.
+ * @param  pRect1: First region
+ * @param  pRect2: Second region
+ * @param  pMerged: Filled with the box around both regions
+ * @retval Extra cost in pixels, zero or less if the merged region is cheaper
  */
-void LCD_DrawRect(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height)
+static int32_t DirtyMergeCost(const Rect *pRect1, const Rect *pRect2, Rect *pMerged)
 {
-	/* Draw horizontal lines */
-	LCD_DrawHLine(Xpos, Ypos, Width);
-	LCD_DrawHLine(Xpos, (Ypos+ Height), Width);
+	int32_t x1 = pRect1->X < pRect2->X ? pRect1->X : pRect2->X;
+	int32_t y1 = pRect1->Y < pRect2->Y ? pRect1->Y : pRect2->Y;
+	int32_t x2 = pRect1->X + pRect1->Width > pRect2->X + pRect2->Width ? pRect1->X + pRect1->Width : pRect2->X + pRect2->Width;
+	int32_t y2 = pRect1->Y + pRect1->Height > pRect2->Y + pRect2->Height ? pRect1->Y + pRect1->Height : pRect2->Y + pRect2->Height;
 
-	/* Draw vertical lines */
-	LCD_DrawVLine(Xpos, Ypos, Height);
-	LCD_DrawVLine((Xpos + Width - 1), Ypos, Height);
+	pMerged->X = x1;
+	pMerged->Y = y1;
+	pMerged->Width = x2 - x1;
+	pMerged->Height = y2 - y1;
+
+	/* Overlapping pixels are redrawn twice by separate regions */
+	return (x2 - x1) * (y2 - y1) - (int32_t)pRect1->Width * pRect1->Height
+	       - (int32_t)pRect2->Width * pRect2->Height - DIRTY_REGION_COST;
 }
 
 /**
- * @brief  Draws a circle.
+ * @brief  Marks an area of the screen to be redrawn by LCD_FlushDirty(). Regions
+ *         are merged while their box costs less to redraw than keeping them apart.
+ *         Regions are kept in the current rotation.
  * @param  Xpos: X position
  * @param  Ypos: Y position
- * @param  Radius: Circle radius
+ * @param  Width: Area width
+ * @param  Height: Area height
  */
-void LCD_DrawCircle(uint16_t Xpos, uint16_t Ypos, uint16_t Radius)
+void LCD_Invalidate(int16_t Xpos, int16_t Ypos, uint16_t Width, uint16_t Height)
 {
-	int32_t  D;       /* Decision Variable */
-	uint32_t  CurX;   /* Current X Value */
-	uint32_t  CurY;   /* Current Y Value */
+	int32_t x1 = Xpos, y1 = Ypos, x2 = Xpos + Width, y2 = Ypos + Height, cost = 0, best = 0;
+	uint8_t i = 0, merge = 0;
+	Rect area, merged;
 
-	D = 3 - (Radius << 1);
-	CurX = 0;
-	CurY = Radius;
+	if(x1 < 0) x1 = 0;
+	if(y1 < 0) y1 = 0;
+	if(x2 > LCD_GetWidth()) x2 = LCD_GetWidth();
+	if(y2 > LCD_GetHeight()) y2 = LCD_GetHeight();
 
-	while (CurX <= CurY)
+	if(x2 <= x1 || y2 <= y1)
 	{
-		LCD_DrawPixel((Xpos + CurX), (Ypos - CurY), DrawProp.TextColor);
-
-		LCD_DrawPixel((Xpos - CurX), (Ypos - CurY), DrawProp.TextColor);
-
-		LCD_DrawPixel((Xpos + CurY), (Ypos - CurX), DrawProp.TextColor);
-
-		LCD_DrawPixel((Xpos - CurY), (Ypos - CurX), DrawProp.TextColor);
-
-		LCD_DrawPixel((Xpos + CurX), (Ypos + CurY), DrawProp.TextColor);
-
-		LCD_DrawPixel((Xpos - CurX), (Ypos + CurY), DrawProp.TextColor);
-
-		LCD_DrawPixel((Xpos + CurY), (Ypos + CurX), DrawProp.TextColor);
+		return;
+	}
 
-		LCD_DrawPixel((Xpos - CurY), (Ypos + CurX), DrawProp.TextColor);
+	area.X = x1;
+	area.Y = y1;
+	area.Width = x2 - x1;
+	area.Height = y2 - y1;
 
-		if (D < 0)
+	/* A merged region may now pay off with another one, a full list
+	 * takes the cheapest merge whatever it costs */
+	while(dirtyCount > 0)
+	{
+		for(i = 0; i < dirtyCount; i++)
 		{
-			D += (CurX << 2) + 6;
+			cost = DirtyMergeCost(&area, &dirtyRects[i], &merged);
+
+			if(i == 0 || cost < best)
+			{
+				best = cost;
+				merge = i;
+			}
 		}
-		else
+
+		if(best > 0 && dirtyCount < MAX_DIRTY_RECTS)
 		{
-			D += ((CurX - CurY) << 2) + 10;
-			CurY--;
+			break;
 		}
-		CurX++;
+
+		DirtyMergeCost(&area, &dirtyRects[merge], &area);
+		dirtyRects[merge] = dirtyRects[--dirtyCount];
 	}
+
+	dirtyRects[dirtyCount++] = area;
 }
 
 /**
- * @brief  Draws an poly-line (between many points).
- * @param  Points: Pointer to the points array
- * @param  PointCount: Number of points
+ * @brief  Redraws the region being flushed.
  */
-void LCD_DrawPolygon(pPoint Points, uint16_t PointCount)
+static void RedrawDirty(void)
 {
-	int16_t X = 0, Y = 0;
+	dirtyRedraw(dirtyArea);
+}
 
-	if(PointCount < 2)
+/**
+ * @brief  Redraws the regions marked by LCD_Invalidate() and empties the list.
+ *         Each region is drawn by LCD_DrawScene() when it can, else straight
+ *         under a clip, so the callback only has to redraw what lies in it,
+ *         background included. Regions invalidated by the callback are kept
+ *         for the next flush.
+ * @param  Redraw: Function redrawing the screen, given the region it is clipped to
+ * @retval LCD_OK, or LCD_ERROR if a region could not be clipped
+ */
+uint8_t LCD_FlushDirty(void (*Redraw)(const Rect *pArea))
+{
+	Rect regions[MAX_DIRTY_RECTS];
+	uint8_t i = 0, count = dirtyCount, status = LCD_OK;
+
+	for(i = 0; i < count; i++)
 	{
-		return;
+		regions[i] = dirtyRects[i];
 	}
 
-	LCD_DrawLine(Points->X, Points->Y, (Points+PointCount-1)->X, (Points+PointCount-1)->Y);
+	dirtyCount = 0;
 
-	while(--PointCount)
+	for(i = 0; i < count; i++)
 	{
-		X = Points->X;
-		Y = Points->Y;
-		Points++;
-		LCD_DrawLine(X, Y, Points->X, Points->Y);
+		dirtyRedraw = Redraw;
+		dirtyArea = &regions[i];
+
+		if(LCD_DrawScene(&regions[i], RedrawDirty) == LCD_OK)
+		{
+			continue;
+		}
+
+		if(LCD_PushClip(regions[i].X, regions[i].Y, regions[i].Width, regions[i].Height) != LCD_OK)
+		{
+			status = LCD_ERROR;
+			continue;
+		}
+
+		Redraw(&regions[i]);
+
+		LCD_PopClip();
 	}
 
+	return status;
 }
 
 /**
- * @brief  Draws an ellipse on LCD.
+ * @brief  Starts recording a display list into a caller buffer.
+ * @param  pList: Display list
+ * @param  pCommands: Buffer the commands are recorded into
+ * @param  Size: Commands the buffer holds
+ */
+void LCD_InitList(DisplayList *pList, ListCommand *pCommands, uint16_t Size)
+{
+	pList->pCommands = pCommands;
+	pList->Size = Size;
+	pList->Count = 0;
+	pList->Overflow = 0;
+}
+
+/**
+ * @brief  Records a command at the end of a display list.
+ * @param  pList: Display list
+ * @param  Command: Command
+ * @param  Arg: Text alignment
+ * @param  Color: Color, or corner radius
  * @param  Xpos: X position
  * @param  Ypos: Y position
- * @param  XRadius: Ellipse X radius
- * @param  YRadius: Ellipse Y radius
+ * @param  Width: Width, circle radius or line X length
+ * @param  Height: Height or line Y length
+ * @param  pData: Text, font or image
  */
-void LCD_DrawEllipse(int Xpos, int Ypos, int XRadius, int YRadius)
+static void ListAdd(DisplayList *pList, List_CommandTypdef Command, uint8_t Arg, uint16_t Color,
+                    int16_t Xpos, int16_t Ypos, int16_t Width, int16_t Height, const void *pData)
 {
-	int x = 0, y = -YRadius, err = 2-2*XRadius, e2;
-	float K = 0, rad1 = 0, rad2 = 0;
+	ListCommand *pCommand;
 
-	rad1 = XRadius;
-	rad2 = YRadius;
+	if(pList->Count >= pList->Size)
+	{
+		pList->Overflow = 1;
+		return;
+	}
 
-	K = (float)(rad2/rad1);
+	pCommand = &pList->pCommands[pList->Count];
 
-	do {
-		LCD_DrawPixel((Xpos-(uint16_t)(x/K)), (Ypos+y), DrawProp.TextColor);
-		LCD_DrawPixel((Xpos+(uint16_t)(x/K)), (Ypos+y), DrawProp.TextColor);
-		LCD_DrawPixel((Xpos+(uint16_t)(x/K)), (Ypos-y), DrawProp.TextColor);
-		LCD_DrawPixel((Xpos-(uint16_t)(x/K)), (Ypos-y), DrawProp.TextColor);
+	pCommand->Command = Command;
+	pCommand->Arg = Arg;
+	pCommand->Color = Color;
+	pCommand->X = Xpos;
+	pCommand->Y = Ypos;
+	pCommand->Width = Width;
+	pCommand->Height = Height;
+	pCommand->pData = pData;
 
-		e2 = err;
-		if (e2 <= x) {
-			err += ++x*2+1;
-			if (-y == x && e2 <= y) e2 = 0;
-		}
-		if (e2 > y) err += ++y*2+1;
-	}
-	while (y <= 0);
+	pList->Count++;
 }
 
 /**
- * @brief  Draws a bitmap picture (16 bpp).
- * @param  Xpos: Bmp X position in the LCD
- * @param  Ypos: Bmp Y position in the LCD
- * @param  pbmp: Pointer to Bmp picture address.
+ * @brief  Records a text color change.
+ * @param  pList: Display list
+ * @param  Color: Text color code RGB(5-6-5)
  */
-void LCD_DrawBitmap(uint16_t Xpos, uint16_t Ypos, uint8_t *pbmp)
+void LCD_ListTextColor(DisplayList *pList, uint16_t Color)
 {
-	uint32_t height = 0;
-	uint32_t width  = 0;
-
-	/* Read bitmap width */
-	width = *(uint16_t *) (pbmp + 18);
-	width |= (*(uint16_t *) (pbmp + 20)) << 16;
-
-	/* Read bitmap height */
-	height = *(uint16_t *) (pbmp + 22);
-	height |= (*(uint16_t *) (pbmp + 24)) << 16;
+	ListAdd(pList, TEXT_COLOR_CMD, 0, Color, 0, 0, 0, 0, NULL);
+}
 
-	LCD_SetDisplayWindow(Xpos, Ypos, width, height);
+/**
+ * @brief  Records a back color change.
+ * @param  pList: Display list
+ * @param  Color: Background color code RGB(5-6-5)
+ */
+void LCD_ListBackColor(DisplayList *pList, uint16_t Color)
+{
+	ListAdd(pList, BACK_COLOR_CMD, 0, Color, 0, 0, 0, 0, NULL);
+}
 
-	lcd_drv->DrawBitmap(Xpos, Ypos, pbmp);
+/**
+ * @brief  Records a font change.
+ * @param  pList: Display list
+ * @param  pFont: Font
+ */
+void LCD_ListFont(DisplayList *pList, sFONT *pFont)
+{
+	ListAdd(pList, FONT_CMD, 0, 0, 0, 0, 0, 0, pFont);
+}
 
-	LCD_SetDisplayWindow(0, 0, LCD_GetWidth(), LCD_GetHeight());
+/**
+ * @brief  Records LCD_FillRect().
+ * @param  pList: Display list
+ * @param  Xpos: X position
+ * @param  Ypos: Y position
+ * @param  Width: Rectangle width
+ * @param  Height: Rectangle height
+ */
+void LCD_ListFillRect(DisplayList *pList, int16_t Xpos, int16_t Ypos, uint16_t Width, uint16_t Height)
+{
+	ListAdd(pList, FILL_RECT_CMD, 0, 0, Xpos, Ypos, Width, Height, NULL);
 }
 
 /**
- * @brief  Draws RGB Image (16 bpp).
- * @param  Xpos:  X position in the LCD
- * @param  Ypos:  Y position in the LCD
- * @param  Xsize: X size in the LCD
- * @param  Ysize: Y size in the LCD
- * @param  pdata: Pointer to the RGB Image address.
+ * @brief  Records LCD_FillRoundRect().
+ * @param  pList: Display list
+ * @param  Xpos: X position
+ * @param  Ypos: Y position
+ * @param  Width: Rectangle width
+ * @param  Height: Rectangle height
+ * @param  Radius: Corner radius
  */
-void LCD_DrawRGBImage(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height, uint16_t *pdata)
+void LCD_ListFillRoundRect(DisplayList *pList, int16_t Xpos, int16_t Ypos, uint16_t Width, uint16_t Height, uint16_t Radius)
 {
-	LCD_SetDisplayWindow(Xpos, Ypos, Width, Height);
+	ListAdd(pList, FILL_ROUND_RECT_CMD, 0, Radius, Xpos, Ypos, Width, Height, NULL);
+}
 
-	lcd_drv->DrawRGBImage(Xpos, Ypos, pdata, Width * Height);
+/**
+ * @brief  Records LCD_FillCircle().
+ * @param  pList: Display list
+ * @param  Xpos: X position
+ * @param  Ypos: Y position
+ * @param  Radius: Circle radius
+ */
+void LCD_ListFillCircle(DisplayList *pList, int16_t Xpos, int16_t Ypos, uint16_t Radius)
+{
+	ListAdd(pList, FILL_CIRCLE_CMD, 0, 0, Xpos, Ypos, Radius, 0, NULL);
+}
 
-	LCD_SetDisplayWindow(0, 0, LCD_GetWidth(), LCD_GetHeight());
+/**
+ * @brief  Records LCD_DrawLine().
+ * @param  pList: Display list
+ * @param  x1: Point 1 X position
+ * @param  y1: Point 1 Y position
+ * @param  x2: Point 2 X position
+ * @param  y2: Point 2 Y position
+ */
+void LCD_ListLine(DisplayList *pList, int16_t x1, int16_t y1, int16_t x2, int16_t y2)
+{
+	ListAdd(pList, LINE_CMD, 0, 0, x1, y1, x2 - x1, y2 - y1, NULL);
 }
 
 /**
- * @brief  Draws a full rectangle.
+ * @brief  Records LCD_DrawRect().
+ * @param  pList: Display list
  * @param  Xpos: X position
  * @param  Ypos: Y position
  * @param  Width: Rectangle width
  * @param  Height: Rectangle height
  */
-void LCD_FillRect(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height)
+void LCD_ListRect(DisplayList *pList, int16_t Xpos, int16_t Ypos, uint16_t Width, uint16_t Height)
 {
-	do
-	{
-		LCD_DrawHLine(Xpos, Ypos++, Width);
-	}
-	while(Height--);
+	ListAdd(pList, RECT_CMD, 0, 0, Xpos, Ypos, Width, Height, NULL);
 }
 
 /**
- * @brief  Draws a full circle.
+ * @brief  Records LCD_DisplayStringAt(). Only the pointer is recorded, the string
+ *         must live as long as the list.
+ * @param  pList: Display list
  * @param  Xpos: X position
  * @param  Ypos: Y position
- * @param  Radius: Circle radius
+ * @param  pText: String
+ * @param  Mode: Alignment, as for LCD_DisplayStringAt()
  */
-void LCD_FillCircle(uint16_t Xpos, uint16_t Ypos, uint16_t Radius)
+void LCD_ListString(DisplayList *pList, int16_t Xpos, int16_t Ypos, uint8_t *pText, Line_ModeTypdef Mode)
 {
-	int32_t  D;        /* Decision Variable */
-	uint32_t  CurX;    /* Current X Value */
-	uint32_t  CurY;    /* Current Y Value */
+	ListAdd(pList, TEXT_CMD, Mode, 0, Xpos, Ypos, 0, 0, pText);
+}
 
-	D = 3 - (Radius << 1);
+/**
+ * @brief  Records LCD_DrawRGBImage(). Only the pointer is recorded, the pixels
+ *         must live as long as the list.
+ * @param  pList: Display list
+ * @param  Xpos: X position
+ * @param  Ypos: Y position
+ * @param  Width: Image width
+ * @param  Height: Image height
+ * @param  pbmp: RGB565 pixels
+ */
+void LCD_ListImage(DisplayList *pList, int16_t Xpos, int16_t Ypos, uint16_t Width, uint16_t Height, uint16_t *pbmp)
+{
+	ListAdd(pList, IMAGE_CMD, 0, 0, Xpos, Ypos, Width, Height, pbmp);
+}
 
-	CurX = 0;
-	CurY = Radius;
+/**
+ * @brief  Records LCD_PushClip().
+ * @param  pList: Display list
+ * @param  Xpos: X position
+ * @param  Ypos: Y position
+ * @param  Width: Clip rectangle width
+ * @param  Height: Clip rectangle height
+ */
+void LCD_ListPushClip(DisplayList *pList, int16_t Xpos, int16_t Ypos, uint16_t Width, uint16_t Height)
+{
+	ListAdd(pList, CLIP_CMD, 0, 0, Xpos, Ypos, Width, Height, NULL);
+}
 
-	while (CurX <= CurY)
+/**
+ * @brief  Records LCD_PopClip().
+ * @param  pList: Display list
+ */
+void LCD_ListPopClip(DisplayList *pList)
+{
+	ListAdd(pList, UNCLIP_CMD, 0, 0, 0, 0, 0, 0, NULL);
+}
+
+/**
+ * @brief  Draws a display list, recorded or const. Commands entirely outside of
+ *         the clip rectangle are skipped without being drawn, so replaying a list
+ *         clipped to a changed region only costs the commands that touch it.
+ *         The colors and font are restored afterwards and the clip rectangles the
+ *         list leaves pushed are popped.
+ * @param  pCommands: Commands
+ * @param  Count: Number of commands
+ * @param  pClip: Rectangle the list is clipped to, NULL for the current clip
+ */
+void LCD_ReplayList(const ListCommand *pCommands, uint16_t Count, const Rect *pClip)
+{
+	uint16_t textColor = DrawProp.TextColor, backColor = DrawProp.BackColor;
+	sFONT *pFont = DrawProp.pFont;
+	uint8_t depth = clipDepth, skip = 0;
+	int32_t x = 0, y = 0, width = 0, height = 0;
+	const ListCommand *pCommand;
+
+	if(pClip != NULL)
 	{
-		if(CurY > 0)
+		if(LCD_PushClip(pClip->X, pClip->Y, pClip->Width, pClip->Height) != LCD_OK)
 		{
-			LCD_DrawHLine(Xpos - CurY, Ypos + CurX, 2*CurY);
-			LCD_DrawHLine(Xpos - CurY, Ypos - CurX, 2*CurY);
+			return;
 		}
+	}
 
-		if(CurX > 0)
+	for(pCommand = pCommands; pCommand < pCommands + Count; pCommand++)
+	{
+		/* Up to the end of a clip rectangle that could not be pushed */
+		if(skip > 0)
 		{
-			LCD_DrawHLine(Xpos - CurX, Ypos - CurY, 2*CurX);
-			LCD_DrawHLine(Xpos - CurX, Ypos + CurY, 2*CurX);
+			if(pCommand->Command == CLIP_CMD) skip++;
+			if(pCommand->Command == UNCLIP_CMD) skip--;
+			continue;
 		}
-		if (D < 0)
+
+		x = pCommand->X;
+		y = pCommand->Y;
+		width = pCommand->Width;
+		height = pCommand->Height;
+
+		/* Box around what the command draws */
+		switch(pCommand->Command)
 		{
-			D += (CurX << 2) + 6;
+		case FILL_CIRCLE_CMD:
+			x -= width;
+			y -= width;
+			width = 2 * width + 1;
+			height = width;
+			break;
+		case LINE_CMD:
+			if(width < 0)
+			{
+				x += width;
+				width = -width;
+			}
+			if(height < 0)
+			{
+				y += height;
+				height = -height;
+			}
+			width++;
+			height++;
+			break;
+		case TEXT_CMD:
+			x = CLIP_LEFT;
+			width = CLIP_RIGHT - CLIP_LEFT;
+			height = DrawProp.pFont->Height * textScale;
+			break;
+		default:
+			break;
 		}
-		else
+
+		switch(pCommand->Command)
 		{
-			D += ((CurX - CurY) << 2) + 10;
-			CurY--;
+		case TEXT_COLOR_CMD:
+			DrawProp.TextColor = pCommand->Color;
+			continue;
+		case BACK_COLOR_CMD:
+			DrawProp.BackColor = pCommand->Color;
+			continue;
+		case FONT_CMD:
+			DrawProp.pFont = (sFONT *)pCommand->pData;
+			continue;
+		case CLIP_CMD:
+			if(LCD_PushClip(x, y, width, height) != LCD_OK)
+			{
+				skip = 1;
+			}
+			continue;
+		case UNCLIP_CMD:
+			if(clipDepth > depth + (pClip != NULL))
+			{
+				LCD_PopClip();
+			}
+			continue;
+		default:
+			break;
 		}
-		CurX++;
-	}
 
-	LCD_DrawCircle(Xpos, Ypos, Radius);
-}
-
-/**
- * @brief  Draws a full ellipse.
- * @param  Xpos: X position
- * @param  Ypos: Y position
- * @param  XRadius: Ellipse X radius
- * @param  YRadius: Ellipse Y radius
- */
-void LCD_FillEllipse(int Xpos, int Ypos, int XRadius, int YRadius)
-{
-	int x = 0, y = -YRadius, err = 2-2*XRadius, e2;
-	float K = 0, rad1 = 0, rad2 = 0;
-
-	rad1 = XRadius;
-	rad2 = YRadius;
-
-	K = (float)(rad2/rad1);
-
-	do
-	{
-		LCD_DrawHLine((Xpos-(uint16_t)(x/K)), (Ypos+y), (2*(uint16_t)(x/K) + 1));
-		LCD_DrawHLine((Xpos-(uint16_t)(x/K)), (Ypos-y), (2*(uint16_t)(x/K) + 1));
+		if(CLIP_OUT(x, y, width, height))
+		{
+			continue;
+		}
 
-		e2 = err;
-		if (e2 <= x)
+		/* Items may start left of or above the screen, where the unsigned
+		 * positions of the public calls cannot reach */
+		switch(pCommand->Command)
 		{
-			err += ++x*2+1;
-			if (-y == x && e2 <= y) e2 = 0;
+		case FILL_RECT_CMD:
+			if(x < 0)
+			{
+				width += x;
+				x = 0;
+			}
+			if(y < 0)
+			{
+				height += y;
+				y = 0;
+			}
+			LCD_FillRect(x, y, width, height);
+			break;
+		case FILL_ROUND_RECT_CMD:
+			LCD_FillRoundRect(pCommand->X, pCommand->Y, pCommand->Width, pCommand->Height, pCommand->Color);
+			break;
+		case FILL_CIRCLE_CMD:
+			FillCircle(pCommand->X, pCommand->Y, pCommand->Width);
+			break;
+		case LINE_CMD:
+			LCD_DrawLine(pCommand->X, pCommand->Y, pCommand->X + pCommand->Width, pCommand->Y + pCommand->Height);
+			break;
+		case RECT_CMD:
+			LCD_DrawHLine(x, y, width);
+			LCD_DrawHLine(x, y + height - 1, width);
+			LCD_DrawVLine(x, y, height);
+			LCD_DrawVLine(x + width - 1, y, height);
+			break;
+		case TEXT_CMD:
+			DisplayString(pCommand->X, pCommand->Y, (const uint8_t *)pCommand->pData, (Line_ModeTypdef)pCommand->Arg);
+			break;
+		case IMAGE_CMD:
+			if(x < 0 || y < 0)
+			{
+				DrawClippedImage(x, y, width, height, (uint16_t *)pCommand->pData);
+			}
+			else
+			{
+				LCD_DrawRGBImage(x, y, width, height, (uint16_t *)pCommand->pData);
+			}
+			break;
+		default:
+			break;
 		}
-		if (e2 > y) err += ++y*2+1;
 	}
-	while (y <= 0);
-}
 
+	while(clipDepth > depth)
+	{
+		LCD_PopClip();
+	}
+
+	DrawProp.TextColor = textColor;
+	DrawProp.BackColor = backColor;
+	DrawProp.pFont = pFont;
+}
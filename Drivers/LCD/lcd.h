@@ -47,14 +47,66 @@
 /* Includes ------------------------------------------------------------------*/
 #include "Fonts/fonts.h"
 
+typedef struct 
+{
+  int16_t  X;
+  int16_t  Y;
+  uint16_t Width;
+  uint16_t Height;
+
+}Rect, * pRect;
+
+typedef struct 
+{
+  int16_t  X;
+  int16_t  Y;
+  uint16_t Length;
+
+}Span, * pSpan;
+
  typedef struct
 { 
   uint16_t TextColor;
   uint16_t BackColor;
   sFONT    *pFont; 
+  Rect     Clip;
 
 }LCD_DrawPropTypeDef;
 
+/** 
+  * @brief  Text field, remembers what it shows to redraw only the changed characters
+  */
+#ifndef TEXT_FIELD_SIZE
+#define TEXT_FIELD_SIZE         32
+#endif
+
+typedef struct
+{
+  int16_t  X;
+  int16_t  Y;
+  sFONT    *pFont;              /*!< Font of the shown text, NULL before the first update */
+  uint8_t  Scale;               /*!< Text scale of the shown text */
+  uint16_t TextColor;
+  uint16_t BackColor;
+  uint16_t Width;               /*!< Width of the shown text */
+  uint16_t Size;                /*!< Bytes of the shown text, TEXT_FIELD_SIZE + 1 if it did not fit */
+  uint8_t  Text[TEXT_FIELD_SIZE];
+
+}TextField;
+
+/* Longest formatted number, padding included */
+#define NUMBER_BUFFER_SIZE      32
+
+/** 
+  * @brief  Text box, lines appended at the bottom scroll the older ones up
+  */
+typedef struct
+{
+  Rect     Area;
+  int16_t  Used;                /*!< Height of the lines shown from the top of the area */
+
+}TextBox;
+
 /** 
   * @brief  LCD status structure definition  
   */     
@@ -80,6 +132,153 @@ typedef enum
 
 }Line_ModeTypdef;
 
+/** 
+  * @brief  Text background structures definition
+  */ 
+typedef enum
+{
+  OPAQUE_TEXT             = 0x01,    /*!< Glyph background painted with the back color  */
+  TRANSPARENT_TEXT        = 0x02     /*!< Only glyph foreground pixels are written  */
+
+}Text_ModeTypdef;
+
+/** 
+  * @brief  Polygon fill rule structures definition
+  */ 
+typedef enum
+{
+  EVENODD_RULE            = 0x01,    /*!< Even-odd rule          */
+  NONZERO_RULE            = 0x02     /*!< Non-zero winding rule  */
+
+}Fill_RuleTypdef;
+
+/** 
+  * @brief  Line cap structures definition
+  */ 
+typedef enum
+{
+  BUTT_CAP                = 0x01,    /*!< Line ends at its end points            */
+  ROUND_CAP               = 0x02,    /*!< Half a disk added at each end          */
+  SQUARE_CAP              = 0x03     /*!< Half a square added at each end        */
+
+}Line_CapTypdef;
+
+/** 
+  * @brief  Anti-aliasing background structures definition
+  */ 
+typedef enum
+{
+  AA_BACKCOLOR_MODE       = 0x01,    /*!< Blend against the background color  */
+  AA_READBACK_MODE        = 0x02     /*!< Blend against pixels read from GRAM  */
+
+}AA_ModeTypdef;
+
+/** 
+  * @brief  Gradient fill modes definition, DITHER_GRADIENT may be OR'ed with a direction
+  */ 
+typedef enum
+{
+  HORIZONTAL_GRADIENT     = 0x00,    /*!< Color0 on the left edge, Color1 on the right edge  */
+  VERTICAL_GRADIENT       = 0x01,    /*!< Color0 on the top edge, Color1 on the bottom edge  */
+  DITHER_GRADIENT         = 0x02     /*!< Ordered dither to hide RGB565 banding  */
+
+}Gradient_ModeTypdef;
+
+/** 
+  * @brief  Number padding definition, numbers are padded up to a number of characters
+  */ 
+typedef enum
+{
+  RIGHT_SPACE_PAD         = 0x01,    /*!< Right aligned, spaces before the number  */
+  RIGHT_ZERO_PAD          = 0x02,    /*!< Right aligned, zeros between the sign and the digits  */
+  LEFT_SPACE_PAD          = 0x03     /*!< Left aligned, spaces after the number  */
+
+}Number_PadTypdef;
+
+/** 
+  * @brief  Text box wrapping definition, lines always break at '\n'
+  */ 
+typedef enum
+{
+  WORD_WRAP               = 0x01,    /*!< Lines break between words, words longer than a line between characters  */
+  CHAR_WRAP               = 0x02,    /*!< Lines break between any characters  */
+  NO_WRAP                 = 0x03     /*!< Long lines are clipped  */
+
+}Text_WrapTypdef;
+
+/** 
+  * @brief  Vertical text direction definition
+  */ 
+typedef enum
+{
+  BOTTOM_TO_TOP           = 0x01,    /*!< Turned 90 degrees counterclockwise, glyph tops on the left  */
+  TOP_TO_BOTTOM           = 0x02     /*!< Turned 90 degrees clockwise, glyph tops on the right  */
+
+}Text_DirectionTypdef;
+
+/** 
+  * @brief  Display list commands definition
+  */ 
+typedef enum
+{
+  TEXT_COLOR_CMD          = 0x01,    /*!< Text color set to Color  */
+  BACK_COLOR_CMD          = 0x02,    /*!< Back color set to Color  */
+  FONT_CMD                = 0x03,    /*!< Font set to pData  */
+  FILL_RECT_CMD           = 0x04,    /*!< Rectangle filled  */
+  FILL_ROUND_RECT_CMD     = 0x05,    /*!< Rectangle with corners of Color radius filled  */
+  FILL_CIRCLE_CMD         = 0x06,    /*!< Circle of Width radius filled around X, Y  */
+  LINE_CMD                = 0x07,    /*!< Line from X, Y to X + Width, Y + Height  */
+  RECT_CMD                = 0x08,    /*!< Rectangle outline  */
+  TEXT_CMD                = 0x09,    /*!< String pData aligned by Arg (Line_ModeTypdef)  */
+  IMAGE_CMD               = 0x0A,    /*!< RGB565 pixels pData  */
+  CLIP_CMD                = 0x0B,    /*!< Clip rectangle pushed  */
+  UNCLIP_CMD              = 0x0C     /*!< Clip rectangle popped  */
+
+}List_CommandTypdef;
+
+/** 
+  * @brief  Display list command, fixed size so that lists in flash can point to
+  *         strings, fonts and images. Unused fields are 0
+  */
+typedef struct
+{
+  uint8_t  Command;             /*!< List_CommandTypdef */
+  uint8_t  Arg;                 /*!< Line_ModeTypdef of TEXT_CMD */
+  uint16_t Color;               /*!< Color, or corner radius of FILL_ROUND_RECT_CMD */
+  int16_t  X;
+  int16_t  Y;
+  int16_t  Width;
+  int16_t  Height;
+  const void *pData;
+
+}ListCommand;
+
+/** 
+  * @brief  Display list recorded into a caller buffer
+  */
+typedef struct
+{
+  ListCommand *pCommands;
+  uint16_t Size;                /*!< Commands the buffer holds */
+  uint16_t Count;               /*!< Commands recorded */
+  uint8_t  Overflow;            /*!< Set when a command did not fit */
+
+}DisplayList;
+
+/* Initializers of the commands of const display lists */
+#define LIST_TEXT_COLOR(c)                 { TEXT_COLOR_CMD, 0, (c), 0, 0, 0, 0, 0 }
+#define LIST_BACK_COLOR(c)                 { BACK_COLOR_CMD, 0, (c), 0, 0, 0, 0, 0 }
+#define LIST_FONT(font)                    { FONT_CMD, 0, 0, 0, 0, 0, 0, (font) }
+#define LIST_FILL_RECT(x, y, w, h)         { FILL_RECT_CMD, 0, 0, (x), (y), (w), (h), 0 }
+#define LIST_FILL_ROUND_RECT(x, y, w, h, r) { FILL_ROUND_RECT_CMD, 0, (r), (x), (y), (w), (h), 0 }
+#define LIST_FILL_CIRCLE(x, y, r)          { FILL_CIRCLE_CMD, 0, 0, (x), (y), (r), 0, 0 }
+#define LIST_LINE(x1, y1, x2, y2)          { LINE_CMD, 0, 0, (x1), (y1), (x2) - (x1), (y2) - (y1), 0 }
+#define LIST_RECT(x, y, w, h)              { RECT_CMD, 0, 0, (x), (y), (w), (h), 0 }
+#define LIST_TEXT(x, y, text, mode)        { TEXT_CMD, (mode), 0, (x), (y), 0, 0, (text) }
+#define LIST_IMAGE(x, y, w, h, pixels)     { IMAGE_CMD, 0, 0, (x), (y), (w), (h), (pixels) }
+#define LIST_CLIP(x, y, w, h)              { CLIP_CMD, 0, 0, (x), (y), (w), (h), 0 }
+#define LIST_UNCLIP()                      { UNCLIP_CMD, 0, 0, 0, 0, 0, 0, 0 }
+
 /** 
   * @brief  LCD color  
   */ 
@@ -136,10 +335,30 @@ uint16_t LCD_GetBackColor(void);
 void     LCD_SetBackColor(uint16_t Color);
 sFONT*   LCD_GetFont(void);
 void     LCD_SetFont(sFONT *fonts);
+void     LCD_SetTextMode(Text_ModeTypdef Mode);
+void     LCD_SetTextScale(uint8_t Scale);
+
+uint8_t  LCD_PushClip(int16_t Xpos, int16_t Ypos, uint16_t Width, uint16_t Height);
+void     LCD_PopClip(void);
 
-void     LCD_DisplayChar(uint16_t Xpos, uint16_t Ypos, uint8_t Ascii);
+void     LCD_DisplayChar(uint16_t Xpos, uint16_t Ypos, uint16_t Code);
 void     LCD_DisplayStringAtLine(uint16_t Line, uint8_t *ptr);
 void     LCD_DisplayStringAt(uint16_t Xpos, uint16_t Ypos, uint8_t *Text, Line_ModeTypdef Mode);
+void     LCD_DisplayStringVertical(uint16_t Xpos, uint16_t Ypos, uint8_t *pText, Text_DirectionTypdef Direction);
+uint16_t LCD_MeasureString(uint8_t *pText);
+void     LCD_GetGlyphCacheStats(uint32_t *pHits, uint32_t *pMisses);
+void     LCD_ClearGlyphCache(void);
+uint16_t LCD_FormatInt(uint8_t *pText, int32_t Value, uint8_t Width, Number_PadTypdef Pad);
+uint16_t LCD_FormatFixed(uint8_t *pText, int32_t Value, uint8_t Decimals, uint8_t Width, Number_PadTypdef Pad);
+uint16_t LCD_FormatHex(uint8_t *pText, uint32_t Value, uint8_t Width, Number_PadTypdef Pad);
+void     LCD_DrawInt(uint16_t Xpos, uint16_t Ypos, int32_t Value, uint8_t Width, Number_PadTypdef Pad);
+void     LCD_DrawFixed(uint16_t Xpos, uint16_t Ypos, int32_t Value, uint8_t Decimals, uint8_t Width, Number_PadTypdef Pad);
+void     LCD_DrawHex(uint16_t Xpos, uint16_t Ypos, uint32_t Value, uint8_t Width, Number_PadTypdef Pad);
+void     LCD_InitTextField(TextField *pField, int16_t Xpos, int16_t Ypos);
+void     LCD_UpdateTextField(TextField *pField, uint8_t *pText);
+uint16_t LCD_DrawTextBox(const Rect *pRect, uint8_t *pText, Line_ModeTypdef Align, Text_WrapTypdef Wrap, int16_t Offset);
+void     LCD_InitTextBox(TextBox *pBox, int16_t Xpos, int16_t Ypos, uint16_t Width, uint16_t Height);
+void     LCD_AppendTextBox(TextBox *pBox, uint8_t *pText, Line_ModeTypdef Align, Text_WrapTypdef Wrap);
 void     LCD_ClearStringLine(uint16_t Line);
 
 uint16_t LCD_ReadPixel(uint16_t Xpos, uint16_t Ypos);
@@ -151,12 +370,47 @@ void     LCD_DrawRect(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Hei
 void     LCD_DrawCircle(uint16_t Xpos, uint16_t Ypos, uint16_t Radius);
 void     LCD_DrawPolygon(pPoint Points, uint16_t PointCount);
 void     LCD_DrawEllipse(int Xpos, int Ypos, int XRadius, int YRadius);
+void     LCD_DrawRoundRect(int16_t Xpos, int16_t Ypos, uint16_t Width, uint16_t Height, uint16_t Radius);
+void     LCD_DrawArc(int16_t Xpos, int16_t Ypos, uint16_t Radius, int16_t StartAngle, int16_t EndAngle);
+void     LCD_DrawThickLine(int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t Width, Line_CapTypdef Cap);
 void     LCD_DrawBitmap(uint16_t Xpos, uint16_t Ypos, uint8_t *pbmp);
 void     LCD_DrawRGBImage(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height, uint16_t *pbmp);
+void     LCD_ReadRGBImage(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height, uint16_t *pbmp);
+void     LCD_CopyRect(int16_t Xpos, int16_t Ypos, uint16_t Width, uint16_t Height, int16_t DstX, int16_t DstY);
 
 void     LCD_FillRect(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height);
 void     LCD_FillCircle(uint16_t Xpos, uint16_t Ypos, uint16_t Radius);
 void     LCD_FillEllipse(int Xpos, int Ypos, int XRadius, int YRadius);
+void     LCD_FillPolygon(pPoint Points, uint16_t PointCount, Fill_RuleTypdef Rule);
+void     LCD_FillTriangle(int16_t x1, int16_t y1, int16_t x2, int16_t y2, int16_t x3, int16_t y3);
+void     LCD_FillRoundRect(int16_t Xpos, int16_t Ypos, uint16_t Width, uint16_t Height, uint16_t Radius);
+void     LCD_FillPie(int16_t Xpos, int16_t Ypos, uint16_t Radius, int16_t StartAngle, int16_t EndAngle);
+void     LCD_FillRects(const Rect *pRects, uint16_t Count, uint16_t Color);
+void     LCD_FillSpans(const Span *pSpans, uint16_t Count);
+void     LCD_FillGradient(int16_t Xpos, int16_t Ypos, uint16_t Width, uint16_t Height, uint16_t Color0, uint16_t Color1, uint8_t Mode);
+
+void     LCD_SetAAMode(AA_ModeTypdef Mode);
+void     LCD_DrawAALine(int16_t x1, int16_t y1, int16_t x2, int16_t y2);
+void     LCD_DrawAACircle(uint16_t Xpos, uint16_t Ypos, uint16_t Radius);
+
+uint8_t  LCD_DrawScene(const Rect *pArea, void (*Scene)(void));
+void     LCD_Invalidate(int16_t Xpos, int16_t Ypos, uint16_t Width, uint16_t Height);
+uint8_t  LCD_FlushDirty(void (*Redraw)(const Rect *pArea));
+
+void     LCD_InitList(DisplayList *pList, ListCommand *pCommands, uint16_t Size);
+void     LCD_ListTextColor(DisplayList *pList, uint16_t Color);
+void     LCD_ListBackColor(DisplayList *pList, uint16_t Color);
+void     LCD_ListFont(DisplayList *pList, sFONT *pFont);
+void     LCD_ListFillRect(DisplayList *pList, int16_t Xpos, int16_t Ypos, uint16_t Width, uint16_t Height);
+void     LCD_ListFillRoundRect(DisplayList *pList, int16_t Xpos, int16_t Ypos, uint16_t Width, uint16_t Height, uint16_t Radius);
+void     LCD_ListFillCircle(DisplayList *pList, int16_t Xpos, int16_t Ypos, uint16_t Radius);
+void     LCD_ListLine(DisplayList *pList, int16_t x1, int16_t y1, int16_t x2, int16_t y2);
+void     LCD_ListRect(DisplayList *pList, int16_t Xpos, int16_t Ypos, uint16_t Width, uint16_t Height);
+void     LCD_ListString(DisplayList *pList, int16_t Xpos, int16_t Ypos, uint8_t *pText, Line_ModeTypdef Mode);
+void     LCD_ListImage(DisplayList *pList, int16_t Xpos, int16_t Ypos, uint16_t Width, uint16_t Height, uint16_t *pbmp);
+void     LCD_ListPushClip(DisplayList *pList, int16_t Xpos, int16_t Ypos, uint16_t Width, uint16_t Height);
+void     LCD_ListPopClip(DisplayList *pList);
+void     LCD_ReplayList(const ListCommand *pCommands, uint16_t Count, const Rect *pClip);
 
 
 #ifdef __cplusplus
@@ -69,6 +69,10 @@ typedef struct
 
 	void (*DrawBitmap)(uint16_t, uint16_t, uint8_t*);
 	void (*DrawRGBImage)(uint16_t, uint16_t, uint16_t*, uint32_t);
+	void (*ReadRGBImage)(uint16_t, uint16_t, uint16_t*, uint32_t);
+	void (*WriteGRAM)(uint16_t*, uint32_t);
+	void (*FillGRAM)(uint16_t, uint32_t);
+	void (*WriteRowPixels)(uint16_t, uint16_t*, uint16_t, uint16_t);
 } LCD_DrvTypeDef;
 
 #ifdef __cplusplus
@@ -56,6 +56,9 @@
 #define LCD_WR  PCout(10)
 #define LCD_RD	PCout(11)
 
+/* nRD low pulse has to be held for the GRAM read access time */
+#define LCD_IO_READ_DELAY()  do { __NOP(); __NOP(); __NOP(); __NOP(); __NOP(); __NOP(); __NOP(); __NOP(); } while(0)
+
 void _LCD_IO_Config_DATA_Input()
 {
 	GPIO_InitTypeDef GPIO_InitStructure;
@@ -204,3 +207,45 @@ void LCD_IO_WriteRegArray(uint8_t Reg, uint16_t *pData, uint32_t Size)
 	LCD_CS = 1;
 }
 
+/************************************************************************
+ **                                                                    **
+ ** nCS       ----\__________________________________________/-------  **
+ ** RS        ------\____________/-----------------------------------  **
+ ** nRD       -------------------------\__/--\_____/--\_____/--------  **
+ ** nWR       --------\_______/--------------------------------------  **
+ ** DB[0:15]  ---------[index]--------[dummy]-[data]---[data]--------  **
+ **                                                                    **
+ ************************************************************************/
+void LCD_IO_ReadRegArray(uint8_t Reg, uint16_t *pData, uint32_t Size)
+{
+	LCD_CS = 0;
+
+	// write register index
+	LCD_RS = 0;
+	LCD_RD = 1;
+	GPIOC->ODR = (GPIOC->ODR&0xff00)|(Reg&0x00ff);
+	GPIOB->ODR = (GPIOB->ODR&0x00ff)|(Reg&0xff00);
+	LCD_WR = 0;
+	LCD_WR = 1;
+	LCD_RS = 1;
+
+	_LCD_IO_Config_DATA_Input();
+
+	// the first read after the index is a dummy one
+	LCD_RD = 0;
+	LCD_IO_READ_DELAY();
+	LCD_RD = 1;
+
+	// read register data
+	for(uint32_t index=0; index < Size; index++)
+	{
+		LCD_RD = 0;
+		LCD_IO_READ_DELAY();
+		pData[index] = ((GPIOB->IDR&0xff00)|(GPIOC->IDR&0x00ff));
+		LCD_RD = 1;
+	}
+
+	_LCD_IO_Config_DATA_Output();
+
+	LCD_CS = 1;
+}
@@ -17,6 +17,7 @@
 void     LCD_IO_Init(void);
 
 uint16_t LCD_IO_ReadReg(uint8_t Reg);
+void     LCD_IO_ReadRegArray(uint8_t Reg, uint16_t *pData, uint32_t Size);
 
 void     LCD_IO_WriteReg(uint8_t Reg, uint16_t Data);
 void     LCD_IO_WriteRegN(uint8_t Reg, uint16_t Data, uint32_t Count);
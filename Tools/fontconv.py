@@ -0,0 +1,496 @@
+#!/usr/bin/env python3
+"""
+Converts fonts to the packed sFONT format of Drivers/LCD/Fonts.
+
+Every glyph is cropped to the bounding box of its set pixels and stored as
+a bit stream, MSB first, rows following each other without padding. The
+sGLYPH entries give the byte offset of each glyph in the table and where
+its box sits relative to the pen position and the top of the line.
+Small monospaced fonts whose 6 byte glyph entries would cost more than the
+cropping saves, like Font8, are written as whole cells instead, each row
+padded to bytes and no sGLYPH table.
+Proportional fonts also get a per-glyph advance table and, for outline
+fonts, the kerning pairs between the converted characters.
+
+Outline fonts can be converted anti-aliased with --bpp 2 or 4, each pixel
+then holds a coverage value instead of a single bit.
+
+Any blocks of Unicode characters up to U+FFFF can be converted, e.g.
+Cyrillic next to ASCII. Fonts other than the plain 0x20..0x7E block get a
+sorted range table that the driver binary searches; characters outside
+the ranges, or missing from the source font, are drawn with the --fallback
+glyph.
+
+Inputs:
+  *.bdf        X11 bitmap fonts
+  *.ttf, *.otf outline fonts rendered with Pillow at --size pixels
+  *.c          sFONT C files, legacy uncompressed tables or packed ones
+
+Examples:
+  fontconv.py Drivers/LCD/Fonts/font16.c -o Drivers/LCD/Fonts/font16.c
+  fontconv.py Drivers/LCD/Fonts/font8.c -o Drivers/LCD/Fonts/font8.c
+  fontconv.py cour.ttf --size 14 --name Font14 -o font14.c
+  fontconv.py DejaVuSans.ttf --size 16 --proportional --name FontSans16 -o fontsans16.c
+  fontconv.py DejaVuSans.ttf --size 14 --bpp 4 --name FontSmooth14 -o fontsmooth14.c
+  fontconv.py 6x13.bdf --ranges 0x20-0x7E,0xB0,0x410-0x44F --name Font13 -o font13.c
+"""
+
+import argparse
+import os
+import re
+import sys
+
+ASCII = [(0x20, 0x7E)]
+MAX_BOX_WIDTH = 24
+
+
+class Font:
+    def __init__(self, name, width, height):
+        self.name = name
+        self.width = width          # cell width of monospaced fonts, widest advance otherwise
+        self.height = height
+        self.glyphs = {}            # code -> {(x, y): level}, x from the pen, y from the line top
+        self.bpp = 1                # levels go from 1 to 2^bpp - 1
+        self.advances = {}          # code -> advance
+        self.kerning = {}           # (first, second) -> advance adjustment
+        self.ranges = ASCII         # [(first, last)] of the characters in the font
+        self.fallback = ord('?')
+        self.header = None          # comment block copied to the output
+        self.description = None
+
+    def requantize(self, bpp):
+        old, new = (1 << self.bpp) - 1, (1 << bpp) - 1
+        for code, pixels in self.glyphs.items():
+            levels = {p: (v * new + old // 2) // old for p, v in pixels.items()}
+            self.glyphs[code] = {p: v for p, v in levels.items() if v > 0}
+        self.bpp = bpp
+
+    def proportional(self):
+        return len(set(self.advances.values())) > 1 or any(a != self.width for a in self.advances.values())
+
+
+def range_codes(ranges):
+    return [code for first, last in ranges for code in range(first, last + 1)]
+
+
+def parse_ranges(text):
+    ranges = []
+    for block in text.split(','):
+        first, _, last = block.partition('-')
+        ranges.append((int(first, 0), int(last or first, 0)))
+    ranges.sort()
+    for (a, b), (c, d) in zip(ranges, ranges[1:]):
+        if c <= b:
+            sys.exit('ranges 0x%X-0x%X and 0x%X-0x%X overlap' % (a, b, c, d))
+    if any(a > b or b > 0xFFFF for a, b in ranges):
+        sys.exit('invalid range, codes go up to 0xFFFF')
+    return ranges
+
+
+C_CHAR = r"('(?:\\.|[^'\\])'|-?\w+)"
+
+
+def c_int(token):
+    """Value of a C integer or character literal."""
+    if token.startswith("'"):
+        return ord(token[2] if token[1] == '\\' else token[1])
+    return int(token, 0)
+
+
+def c_array(text, ctype, name):
+    m = re.search(r'const %s\s+%s\s*\[\]\s*=\s*\{(.*?)\};' % (ctype, name), text, re.S)
+    return re.sub(r'//[^\n]*', '', m.group(1)) if m else None
+
+
+def load_c(path, name):
+    text = open(path).read()
+
+    m = re.search(r'sFONT\s+(\w+)\s*=\s*\{\s*(\w+)\s*,\s*(\d+)\s*,.*?\n\s*(\d+)\s*,(.*?)\};', text, re.S)
+    if not m:
+        sys.exit('%s: no sFONT definition found' % path)
+    font = Font(name or m.group(1), int(m.group(3)), int(m.group(4)))
+    # glyphs, advances, kerning, kerningCount, ranges, rangeCount, fallback, bpp
+    fields = [f.strip() for f in re.sub(r'/\*.*?\*/', '', m.group(5), flags=re.S).split(',')]
+    present = len([f for f in fields if f])
+    fields = (fields + ['0'] * 8)[:8]
+    if present > 7:
+        font.bpp = max(int(fields[7], 0), 1)
+
+    table = c_array(text, 'uint8_t', m.group(2))
+    if table is None:
+        sys.exit('%s: table %s not found' % (path, m.group(2)))
+    data = [int(v, 16) for v in re.findall(r'0x[0-9A-Fa-f]+', table)]
+
+    ranges = c_array(text, 'sRANGE', fields[4])
+    if ranges is not None:
+        font.ranges = [(c_int(a), c_int(b)) for a, b, g in
+                       re.findall(r'\{\s*%s\s*,\s*%s\s*,\s*(\w+)\s*\}' % (C_CHAR, C_CHAR), ranges)]
+    codes = range_codes(font.ranges)
+    if present > 6:
+        font.fallback = codes[int(fields[6], 0)]
+
+    glyphs = c_array(text, 'sGLYPH', fields[0])
+    if glyphs is None:
+        # Whole cells, each row padded to bytes
+        stride = (font.width + 7) // 8
+        size = stride * font.height
+        for index in range(len(data) // size):
+            pixels = {}
+            for y in range(font.height):
+                line = 0
+                for b in data[index * size + y * stride:index * size + (y + 1) * stride]:
+                    line = (line << 8) | b
+                pixels.update({(x, y): 1 for x in range(font.width) if (line >> (8 * stride - 1 - x)) & 1})
+            font.glyphs[codes[index]] = pixels
+    else:
+        for index, entry in enumerate(re.findall(r'\{([^}]*)\}', glyphs)):
+            offset, w, h, left, top = [int(v) for v in entry.split(',')[:5]]
+            bits = [(data[offset + i // 8] >> (7 - i % 8)) & 1 for i in range(w * h * font.bpp)]
+            levels = [int(''.join(map(str, bits[i:i + font.bpp])), 2) for i in range(0, len(bits), font.bpp)]
+            font.glyphs[codes[index]] = {(left + i % w, top + i // w): v for i, v in enumerate(levels) if v}
+
+    advances = c_array(text, 'uint8_t', fields[1])
+    for code in font.glyphs:
+        font.advances[code] = font.width
+    if advances is not None:
+        for index, value in enumerate(re.findall(r'\d+', advances)):
+            font.advances[codes[index]] = int(value)
+
+    kerning = c_array(text, 'sKERNPAIR', fields[2])
+    if kerning is not None:
+        for first, second, offset in re.findall(r'\{\s*%s\s*,\s*%s\s*,\s*(-?\d+)\s*\}' % (C_CHAR, C_CHAR), kerning):
+            font.kerning[(c_int(first), c_int(second))] = int(offset)
+
+    header = re.match(r'\s*(/\*.*?\*/)', text, re.S)
+    font.header = header.group(1) if header else None
+    desc = re.search(r'//\s*(Font data for [^\n]*)', text)
+    font.description = desc.group(1).strip() if desc else None
+    return font
+
+
+def load_bdf(path, name, proportional):
+    lines = open(path, encoding='latin-1').read().splitlines()
+    props = {}
+    glyphs = []
+    i = 0
+    while i < len(lines):
+        words = lines[i].split()
+        if not words:
+            i += 1
+            continue
+        if words[0] == 'STARTCHAR':
+            glyph = {'code': -1}
+            i += 1
+            while not lines[i].startswith('BITMAP'):
+                w = lines[i].split()
+                if w[0] == 'ENCODING':
+                    glyph['code'] = int(w[1])
+                elif w[0] == 'BBX':
+                    glyph['bbx'] = [int(v) for v in w[1:5]]
+                elif w[0] == 'DWIDTH':
+                    glyph['dwidth'] = int(w[1])
+                i += 1
+            bitmap = []
+            i += 1
+            while not lines[i].startswith('ENDCHAR'):
+                bitmap.append(int(lines[i], 16) if lines[i].strip() else 0)
+                i += 1
+            glyph['bitmap'] = bitmap
+            glyphs.append(glyph)
+        else:
+            props[words[0]] = words[1:]
+        i += 1
+
+    fbb = [int(v) for v in props['FONTBOUNDINGBOX']]
+    ascent = int(props.get('FONT_ASCENT', [fbb[1] + fbb[3]])[0])
+    descent = int(props.get('FONT_DESCENT', [-fbb[3]])[0])
+    # Monospaced cells start at the leftmost pixel of the font
+    shift = 0 if proportional else -fbb[2]
+    font = Font(name or 'Font%d' % (ascent + descent), fbb[0], ascent + descent)
+    for g in glyphs:
+        w, h, xoff, yoff = g['bbx']
+        stride = (w + 7) // 8
+        font.glyphs[g['code']] = {(xoff + shift + c, ascent - (yoff + h) + r): 1
+                                  for r, line in enumerate(g['bitmap']) for c in range(w)
+                                  if (line >> (8 * stride - 1 - c)) & 1}
+        font.advances[g['code']] = g.get('dwidth', fbb[0]) if proportional else fbb[0]
+    if proportional:
+        font.width = max(font.advances.values())
+    font.description = 'Font data for %s' % ' '.join(props.get('FAMILY_NAME', [os.path.basename(path)])).strip('"')
+    return font
+
+
+def load_ttf(path, name, size, codes, proportional, bpp):
+    try:
+        from PIL import Image, ImageDraw, ImageFont
+    except ImportError:
+        sys.exit('TrueType input needs Pillow (pip install pillow)')
+
+    ttf = ImageFont.truetype(path, size)
+    ascent, descent = ttf.getmetrics()
+    advances = {c: int(round(ttf.getlength(chr(c)))) for c in codes}
+    font = Font(name or 'Font%d' % size, max(advances.values()), ascent + descent)
+    margin = size
+    font.bpp = bpp
+    top = (1 << bpp) - 1
+
+    def render(code):
+        image = Image.new('L', (3 * size, font.height), 0)
+        ImageDraw.Draw(image).text((margin, 0), chr(code), font=ttf, fill=255)
+        levels = {(x - margin, y): (image.getpixel((x, y)) * top + 127) // 255
+                  for y in range(font.height) for x in range(3 * size)}
+        return {p: v for p, v in levels.items() if v > 0}
+
+    # Characters the font lacks render as its .notdef box, U+FFFF is never in a font
+    notdef = render(0xFFFF)
+    notdef_advance = int(round(ttf.getlength(chr(0xFFFF))))
+    for code in codes:
+        pixels = render(code)
+        if notdef and pixels == notdef and advances[code] == notdef_advance:
+            continue
+        font.glyphs[code] = pixels
+        font.advances[code] = advances[code] if proportional else font.width
+    if proportional:
+        for a in codes:
+            for b in codes:
+                k = int(round(ttf.getlength(chr(a) + chr(b)) - ttf.getlength(chr(a)) - ttf.getlength(chr(b))))
+                if k != 0:
+                    font.kerning[(a, b)] = k
+    family, style = ttf.getname()
+    font.description = 'Font data for %s %s %dpx' % (family, style, size)
+    return font
+
+
+def pack(font, codes):
+    """Returns the packed table and the (offset, width, height, left, top) of every glyph.
+    Characters missing from the font share the entry of the fallback glyph."""
+    table = []
+    boxes = {}
+    for code in codes:
+        if code not in font.glyphs:
+            continue
+        pixels = font.glyphs[code]
+        if not pixels:
+            boxes[code] = (len(table), 0, 0, 0, 0)
+            continue
+        left = min(x for x, y in pixels)
+        top = min(y for x, y in pixels)
+        w = max(x for x, y in pixels) - left + 1
+        h = max(y for x, y in pixels) - top + 1
+        if w > MAX_BOX_WIDTH and font.bpp == 1:
+            sys.exit('%s: glyph %s is %d pixels wide, the driver reads at most %d'
+                     % (font.name, char_comment(code), w, MAX_BOX_WIDTH))
+        bits = ''.join(format(pixels.get((x, y), 0), '0%db' % font.bpp)
+                       for y in range(top, top + h) for x in range(left, left + w))
+        bits += '0' * (-len(bits) % 8)
+        boxes[code] = (len(table), w, h, left, top)
+        for i in range(0, len(bits), 8):
+            table.append(int(bits[i:i + 8], 2))
+    return table, [boxes.get(code, boxes[font.fallback]) for code in codes]
+
+
+def cells(font, codes):
+    """Returns the whole cell table, rows padded to bytes, or None if the font needs glyph boxes.
+    Characters missing from the font repeat the cell of the fallback glyph."""
+    if font.bpp != 1 or font.proportional() or font.width > MAX_BOX_WIDTH:
+        return None
+    stride = (font.width + 7) // 8
+    table = []
+    for code in codes:
+        pixels = font.glyphs.get(code, font.glyphs[font.fallback])
+        if any(x < 0 or x >= font.width or y < 0 or y >= font.height for x, y in pixels):
+            return None
+        for y in range(font.height):
+            line = sum(1 << (8 * stride - 1 - x) for x in range(font.width) if (x, y) in pixels)
+            table.extend((line >> (8 * i)) & 0xFF for i in reversed(range(stride)))
+    return table
+
+
+def char_comment(code):
+    if code == 0x27:
+        return "'\\''"
+    if code == 0x5C:
+        return "'\\\\'"
+    return "'%c'" % code if 0x20 <= code < 0x7F else 'U+%04X' % code
+
+
+def char_literal(code):
+    return char_comment(code) if 0x20 <= code < 0x7F else '0x%04X' % code
+
+
+def write_c(font, out):
+    codes = range_codes(font.ranges)
+    if font.fallback not in codes:
+        sys.exit('fallback character %s is not in the converted ranges' % char_comment(font.fallback))
+    if font.fallback not in font.glyphs:
+        sys.exit('fallback character %s is missing from the source font' % char_comment(font.fallback))
+    missing = set(code for code in codes if code not in font.glyphs)
+    if missing:
+        print('%s: %d characters missing from the source font, drawn as %s'
+              % (font.name, len(missing), char_comment(font.fallback)), file=sys.stderr)
+    table, entries = pack(font, codes)
+    whole = cells(font, codes)
+    if whole is not None and len(whole) <= len(table) + len(entries) * 6:
+        table, entries = whole, []
+    elif len(table) > 0xFFFF:
+        sys.exit('packed table exceeds the 16 bit glyph offsets')
+    name = font.name
+    proportional = font.proportional()
+    kerning = sorted((a, b, k) for (a, b), k in font.kerning.items()
+                     if a in codes and b in codes and a in font.glyphs and b in font.glyphs)
+
+    o = []
+    if font.header:
+        o.append(font.header)
+    else:
+        o.append('/**\n'
+                 '  ******************************************************************************\n'
+                 '  * @file    %s.c\n'
+                 '  * @brief   This file provides text %s for the LCD driver.\n'
+                 '  *          Generated by Tools/fontconv.py, do not edit.\n'
+                 '  ******************************************************************************\n'
+                 '  */' % (name.lower(), name))
+    o.append('')
+    o.append('/* Includes ------------------------------------------------------------------*/')
+    o.append('#include "fonts.h"')
+    o.append('')
+    o.append('// ')
+    o.append('//  %s' % (font.description or 'Font data'))
+    if entries:
+        o.append('//  Packed by Tools/fontconv.py: glyph boxes as bit streams, rows unpadded')
+    else:
+        o.append('//  Whole cells by Tools/fontconv.py: rows padded to bytes, packing would be larger')
+    o.append('// ')
+    o.append('')
+    o.append('const uint8_t %s_Table[] = ' % name)
+    o.append('{')
+    if entries:
+        for code, (offset, w, h, left, top) in zip(codes, entries):
+            if code in missing:
+                continue
+            data = table[offset:offset + (w * h * font.bpp + 7) // 8]
+            o.append('\t// @%d %s (%dx%d)' % (offset, char_comment(code), w, h))
+            for i in range(0, len(data), 12):
+                o.append('\t' + ' '.join('0x%02X,' % b for b in data[i:i + 12]))
+    else:
+        stride = (font.width + 7) // 8
+        for index, code in enumerate(codes):
+            offset = index * stride * font.height
+            o.append('\t// @%d %s (%d pixels wide)%s' % (offset, char_comment(code), font.width,
+                     ', missing, drawn as %s' % char_comment(font.fallback) if code in missing else ''))
+            for y in range(font.height):
+                row = table[offset + y * stride:offset + (y + 1) * stride]
+                art = ''.join('#' if (row[x // 8] >> (7 - x % 8)) & 1 else ' ' for x in range(font.width))
+                o.append('\t%s // %s' % (' '.join('0x%02X,' % b for b in row), art))
+            if index + 1 < len(codes):
+                o.append('')
+    o.append('};')
+    o.append('')
+    if entries:
+        o.append('const sGLYPH %s_Glyphs[] = ' % name)
+        o.append('{')
+        o.append('\t/* Offset, Width, Height, Left, Top */')
+        for code, (offset, w, h, left, top) in zip(codes, entries):
+            o.append('\t{ %4d, %2d, %2d, %2d, %2d }, // %s%s' % (offset, w, h, left, top, char_comment(code),
+                     ' missing, drawn as %s' % char_comment(font.fallback) if code in missing else ''))
+        o.append('};')
+        o.append('')
+    if proportional:
+        o.append('const uint8_t %s_Advances[] = ' % name)
+        o.append('{')
+        for i in range(0, len(codes), 16):
+            o.append('\t' + ' '.join('%2d,' % font.advances.get(c, font.advances[font.fallback])
+                                      for c in codes[i:i + 16]))
+        o.append('};')
+        o.append('')
+    if kerning:
+        o.append('const sKERNPAIR %s_Kerning[] = ' % name)
+        o.append('{')
+        for a, b, k in kerning:
+            o.append('\t{ %s, %s, %d },' % (char_literal(a), char_literal(b), k))
+        o.append('};')
+        o.append('')
+    sparse = font.ranges != ASCII
+    if sparse:
+        o.append('const sRANGE %s_Ranges[] = ' % name)
+        o.append('{')
+        o.append('\t/* First, Last, Glyph */')
+        glyph = 0
+        for first, last in font.ranges:
+            o.append('\t{ 0x%04X, 0x%04X, %4d },' % (first, last, glyph))
+            glyph += last - first + 1
+        o.append('};')
+        o.append('')
+    o.append('sFONT %s = {' % name)
+    o.append('  %s_Table,' % name)
+    o.append('  %d, /* Width */' % font.width)
+    o.append('  %d, /* Height */' % font.height)
+    o.append('  %s_Glyphs,' % name if entries else '  0, /* Whole cells, packing would not make this font smaller */')
+    o.append('  %s_Advances,' % name if proportional else '  0, /* Monospaced */')
+    o.append('  %s_Kerning,' % name if kerning else '  0, /* No kerning */')
+    o.append('  %d, /* Kerning pairs */' % len(kerning))
+    o.append('  %s_Ranges,' % name if sparse else '  0, /* 0x20..0x7E */')
+    o.append('  %d, /* Ranges */' % (len(font.ranges) if sparse else 0))
+    o.append('  %d, /* Fallback %s */' % (codes.index(font.fallback), char_comment(font.fallback)))
+    o.append('  %d, /* Bits per pixel */' % font.bpp)
+    o.append('};')
+    o.append('')
+    o.append('/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/'
+             if font.header and 'STMicroelectronics' in font.header else '/*****END OF FILE****/')
+
+    out.write('\n'.join(o) + '\n')
+    return (len(table) + len(entries) * 6 + (len(codes) if proportional else 0) + len(kerning) * 6 +
+            (len(font.ranges) * 6 if sparse else 0)), bool(entries)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('input', help='BDF, TTF/OTF or sFONT C file')
+    parser.add_argument('-o', '--output', help='output C file (default: stdout)')
+    parser.add_argument('--name', help='sFONT variable name, e.g. Font16')
+    parser.add_argument('--size', type=int, default=16, help='pixel size of TrueType fonts')
+    parser.add_argument('--proportional', action='store_true',
+                        help='keep per-glyph advances, bearings and kerning of BDF/TrueType fonts')
+    parser.add_argument('--ranges', type=parse_ranges,
+                        help='character blocks, e.g. 0x20-0x7E,0x410-0x44F (default: ASCII, or those of a C input)')
+    parser.add_argument('--bpp', type=int, choices=(1, 2, 4),
+                        help='bits per pixel, 2 and 4 give anti-aliased glyphs (default: 1, or that of a C input)')
+    parser.add_argument('--fallback', type=lambda v: int(v, 0),
+                        help="character drawn for missing ones (default: '?')")
+    args = parser.parse_args()
+    ranges = args.ranges or ASCII
+
+    ext = os.path.splitext(args.input)[1].lower()
+    if ext == '.c':
+        font = load_c(args.input, args.name)
+        ranges = args.ranges or font.ranges
+    elif ext == '.bdf':
+        font = load_bdf(args.input, args.name, args.proportional)
+    elif ext in ('.ttf', '.otf'):
+        font = load_ttf(args.input, args.name, args.size, range_codes(ranges), args.proportional, args.bpp or 1)
+    else:
+        sys.exit('unsupported input %s' % args.input)
+
+    font.ranges = ranges
+    if args.bpp is not None and args.bpp != font.bpp:
+        font.requantize(args.bpp)
+    if args.fallback is not None:
+        font.fallback = args.fallback
+
+    if args.output:
+        with open(args.output, 'w') as out:
+            size, packed = write_c(font, out)
+    else:
+        size, packed = write_c(font, sys.stdout)
+
+    raw = len(range_codes(ranges)) * font.height * ((font.width + 7) // 8)
+    if not packed:
+        print('%s: %dx%d, %d bytes in whole cells, packing would be larger' % (font.name, font.width, font.height, size),
+              file=sys.stderr)
+    else:
+        print('%s: %dx%d, %d bytes packed (%d bytes uncompressed)' % (font.name, font.width, font.height, size, raw),
+              file=sys.stderr)
+
+
+if __name__ == '__main__':
+    main()